@@ -1,11 +1,14 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 
+layout(set = 1, binding = 0) uniform sampler2D albedo; // see: gfx::Texture
+
 layout(location = 0) in  vec3 inRGB;   // input  fragment colour
+layout(location = 1) in  vec2 inUV;    // input  texture coordinates
 layout(location = 0) out vec4 outRGBA; // output fragment colour
 
 void main() {
-	outRGBA = vec4( inRGB, 1.0 );
+	outRGBA = texture( albedo, inUV ) * vec4( inRGB, 1.0 );
 }
 
 // EOF
@@ -1,13 +1,23 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 
+layout(std140, set = 0, binding = 0) uniform Camera { // see: gfx::CameraUniforms
+	mat4 viewProjection;
+} camera;
+
+layout(std140, set = 0, binding = 1) uniform Object { // see: gfx::ObjectUniforms
+	mat4 model;
+} object;
+
 layout(location = 0) in  vec2 inXY;   // input vertex position TODO: vec3 inXYZ
-layout(location = 1) in  vec3 inRGB;  // input vertex colour   TODO: textures later
+layout(location = 1) in  vec3 inRGB;  // input vertex colour
 layout(location = 0) out vec3 outRGB; // output fragment colour
+layout(location = 1) out vec2 outUV;  // output texture coordinates (the rectangle spans the texture once)
 
 void main() {
-	gl_Position = vec4( inXY, .0, 1.0 );
+	gl_Position = camera.viewProjection * object.model * vec4( inXY, .0, 1.0 );
 	outRGB      = inRGB;
+	outUV       = inXY + vec2( 0.5 );
 }
 
 // EOF
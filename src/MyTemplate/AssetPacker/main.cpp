@@ -0,0 +1,200 @@
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/Logging.hpp"
+#include "MyTemplate/Common/AssetPackage.hpp"
+
+// Packs every file in a directory into an asset package (see: `AssetPackage`) and verifies the result;
+// optionally benchmarks cold loads of all the assets from the package against loading them per file.
+
+namespace { // private (file-scope)
+	struct Options final {
+		u64         benchmarkRunCount { 0 };
+		std::string directoryPath     {   };
+		std::string packagePath       {   };
+	}; // end-of-struct: Options
+	
+	
+	
+	// drops the (clean) pages of the file from the page cache so that the next read of it is a cold one:
+	void
+	evictFromPageCache( std::filesystem::path const &path )
+	{
+		auto const fileDescriptor { ::open( path.c_str(), O_RDONLY | O_CLOEXEC ) };
+		if ( fileDescriptor < 0 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open `{}`!", path.string() ) };
+		::fsync( fileDescriptor ); // NOTE: dirty pages can't be dropped
+		auto const result { ::posix_fadvise( fileDescriptor, 0, 0, POSIX_FADV_DONTNEED ) };
+		::close( fileDescriptor );
+		if ( result != 0 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to evict `{}` from the page cache!", path.string() ) };
+	} // end-of-function: evictFromPageCache
+	
+	
+	
+	// the same way the renderer loads assets that aren't packed (i.e. via an intermediate heap buffer):
+	[[nodiscard]] std::vector<char>
+	readFile( std::filesystem::path const &path )
+	{
+		std::ifstream file( path, std::ios::binary | std::ios::ate );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open `{}`!", path.string() ) };
+		std::vector<char> contents( static_cast<std::size_t>( file.tellg() ) );
+		file.seekg( 0 );
+		if ( not file.read( contents.data(), static_cast<std::streamsize>( contents.size() ) ) ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to read `{}`!", path.string() ) };
+		return contents;
+	} // end-of-function: readFile
+	
+	
+	
+	// Reports the median time over the runs to copy every asset into a (pre-allocated) staging buffer, with
+	// the page cache dropped before each run, both from the files themselves and from the package.
+	// NOTE: Only the page cache is dropped, so the results still depend on the storage device (and its caches).
+	void
+	runBenchmark( Options const &options )
+	{
+		std::vector<std::filesystem::path> filePaths;
+		std::vector<std::string>           assetNames;
+		auto const excludedPath { std::filesystem::weakly_canonical( options.packagePath ) };
+		for ( auto const &directoryEntry: std::filesystem::recursive_directory_iterator( options.directoryPath ) ) {
+			if ( directoryEntry.is_regular_file() and std::filesystem::weakly_canonical( directoryEntry.path() ) != excludedPath ) {
+				filePaths.push_back( directoryEntry.path() );
+				assetNames.push_back( directoryEntry.path().lexically_relative( options.directoryPath ).generic_string() );
+			}
+		}
+		u64 totalSize { 0 };
+		for ( auto const &filePath: filePaths )
+			totalSize += std::filesystem::file_size( filePath );
+		std::vector<std::byte> staging( totalSize ); // NOTE: stands in for mapped staging memory (and is touched up front)
+		
+		auto const measure {
+			[&]( auto const &evict, auto const &load ) {
+				std::vector<f64> runMs;
+				runMs.reserve( options.benchmarkRunCount );
+				for ( u64 run{0}; run < options.benchmarkRunCount; ++run ) {
+					evict();
+					auto const start { std::chrono::steady_clock::now() };
+					load();
+					runMs.push_back( std::chrono::duration<f64,std::milli>( std::chrono::steady_clock::now() - start ).count() );
+				}
+				std::ranges::sort( runMs );
+				return runMs[runMs.size() / 2];
+			}
+		};
+		auto const perFileMs {
+			measure(
+				[&] { for ( auto const &filePath: filePaths ) evictFromPageCache( filePath ); },
+				[&] {
+					u64 offset { 0 };
+					for ( auto const &filePath: filePaths ) {
+						auto const contents { readFile( filePath ) };
+						std::memcpy( staging.data() + offset, contents.data(), contents.size() );
+						offset += contents.size();
+					}
+				}
+			)
+		};
+		auto const packageMs {
+			measure(
+				[&] { evictFromPageCache( options.packagePath ); },
+				[&] {
+					AssetPackage const package { options.packagePath };
+					u64 offset { 0 };
+					for ( auto const &assetName: assetNames ) {
+						auto const data { package.get( assetName ) };
+						std::memcpy( staging.data() + offset, data.data(), data.size() );
+						offset += data.size();
+					}
+				}
+			)
+		};
+		fmt::print(
+			"Cold load of {} asset(s) ({} byte(s)): per file {:9.3f} ms | package {:9.3f} ms | {:.2f}x (median of {} run(s))\n",
+			filePaths.size(), totalSize, perFileMs, packageMs, perFileMs / packageMs, options.benchmarkRunCount
+		);
+	} // end-of-function: runBenchmark
+	
+	
+	
+	void
+	printUsage()
+	{
+		fmt::print(
+			"Usage: MyTemplateAssetPacker [options] <directory> <output.pak>\n"
+			"  --benchmark <n>    also report the median cold load time of all assets (per file vs packed) over n runs\n"
+		);
+	} // end-of-function: printUsage
+	
+	
+	
+	[[nodiscard]] std::optional<Options>
+	parseOptions( int argc, char const *argv[] )
+	{
+		Options options {};
+		std::vector<std::string> paths;
+		for ( int i{1}; i < argc; ++i ) {
+			std::string_view const arg { argv[i] };
+			bool const hasValue { i + 1 < argc };
+			if      ( arg == "--benchmark" and hasValue ) options.benchmarkRunCount = std::stoull( argv[++i] );
+			else if ( not arg.starts_with( "--" )       ) paths.emplace_back( arg );
+			else return std::nullopt;
+		}
+		if ( paths.size() != 2 ) [[unlikely]]
+			return std::nullopt;
+		options.directoryPath = paths[0];
+		options.packagePath   = paths[1];
+		return options;
+	} // end-of-function: parseOptions
+} // end-of-unnamed-namespace
+
+int
+main( int argc, char const *argv[] )
+{
+	auto const options { parseOptions( argc, argv ) };
+	if ( not options ) {
+		printUsage();
+		return EXIT_FAILURE;
+	}
+	
+	logging::initialize( spdlog::level::info );
+	std::atexit( spdlog::shutdown );
+	
+	try {
+		auto const assetCount { AssetPackage::write( options->directoryPath, options->packagePath ) };
+		AssetPackage const package { options->packagePath };
+		if ( not package.verify() ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` failed verification!", options->packagePath ) };
+		fmt::print(
+			"Packed {} asset(s) from `{}` into `{}` ({} byte(s))\n",
+			assetCount, options->directoryPath, options->packagePath, std::filesystem::file_size( options->packagePath )
+		);
+		
+		if ( options->benchmarkRunCount > 0 )
+			runBenchmark( *options );
+	}
+	catch ( std::exception const &e ) {
+		spdlog::critical( "std::exception: {}", e.what() );
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+} // end-of-function: main
+
+// EOF
@@ -0,0 +1,424 @@
+#include "MyTemplate/info.hpp"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MyTemplate/Common/utility.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/Logging.hpp"
+#include "MyTemplate/Renderer/Renderer.hpp"
+
+// Drives a headless `gfx::Renderer` through a set of scenarios and reports frame-time percentiles,
+// CPU time per frame stage and host allocations per frame as JSON; optionally compares the results
+// against a previously written JSON file and fails if any of them regressed.
+
+namespace { // private (file-scope)
+	// NOTE: counts every host allocation made through the global `operator new` (by all threads)
+	std::atomic<u64> allocationCount { 0 };
+	
+	// what the draws sample:
+	enum struct Texturing {
+		eDefault,       // the renderer's default texture
+		eMipmapped,     // a large noise texture (minified), with a generated mip chain
+		eBaseLevelOnly, // ditto, without one (i.e. to compare the GPU time against the above)
+	}; // end-of-enum-struct: Texturing
+	
+	struct Scenario final {
+		char const *name;
+		u32         drawCount;
+		u32         framesInFlight { gfx::RendererConfig {}.framesInFlight };
+		Texturing   texturing      { Texturing::eDefault                   };
+	}; // end-of-struct: Scenario
+	
+	// NOTE: the larger draw counts exceed the threshold for parallel command buffer recording
+	std::array constexpr kScenarios {
+		Scenario { .name = "draws_1",             .drawCount =       1                                        },
+		Scenario { .name = "draws_1k",            .drawCount =   1'000                                        },
+		Scenario { .name = "draws_10k",           .drawCount =  10'000                                        },
+		Scenario { .name = "draws_100k",          .drawCount = 100'000                                        },
+		Scenario { .name = "draws_1k_fif_1",      .drawCount =   1'000, .framesInFlight = 1                   },
+		Scenario { .name = "draws_1k_fif_2",      .drawCount =   1'000, .framesInFlight = 2                   },
+		Scenario { .name = "textured_1k",         .drawCount =   1'000, .texturing = Texturing::eMipmapped     },
+		Scenario { .name = "textured_1k_no_mips", .drawCount =   1'000, .texturing = Texturing::eBaseLevelOnly },
+	};
+	
+	u32 constexpr kNoiseTextureSize { 2'048 }; // in texels (square); several times the size of the rectangle on screen
+	
+	u64 constexpr kDefaultFrameCount  { 1'000 };
+	u64 constexpr kDefaultWarmupCount {   100 }; // frames rendered before measuring (pipeline cache, ring growth, etc)
+	f64 constexpr kDefaultTolerance   { 0.10  }; // relative slack before a result counts as a regression
+	f64 constexpr kTimeSlackMs        { 0.05  }; // absolute slack for timings (tiny timings are mostly noise)
+	f64 constexpr kAllocationSlack    { 0.5   }; // absolute slack for allocations per frame (baselines may be 0)
+	
+	struct Options final {
+		u64                        frameCount   { kDefaultFrameCount  };
+		u64                        warmupCount  { kDefaultWarmupCount };
+		f64                        tolerance    { kDefaultTolerance   };
+		std::string                outputPath   { "benchmark.json"    };
+		std::optional<std::string> baselinePath {                     };
+	}; // end-of-struct: Options
+	
+	struct Result final {
+		std::string                 name;
+		u32                         drawCount;
+		u32                         framesInFlight;
+		u64                         frameCount;
+		f64                         p50Ms;
+		f64                         p99Ms;
+		f64                         p999Ms;
+		f64                         meanMs;
+		f64                         maxMs;
+		f64                         gpuMs;        // mean; from the first to the last timestamp of a frame (0 without timestamp support)
+		gfx::Renderer::FrameTimings meanStages;
+		f64                         allocationsPerFrame;
+		u64                         maxAllocationsPerFrame;
+	}; // end-of-struct: Result
+	
+	using Fields = std::map<std::string,f64,std::less<>>; // numeric fields of a result, by JSON key
+	
+	
+	
+	// nearest-rank percentile of sorted samples:
+	[[nodiscard]] f64
+	getPercentile( std::vector<f64> const &sortedSamples, f64 const percentile ) noexcept
+	{
+		auto const rank { static_cast<u64>( std::ceil( percentile * static_cast<f64>( sortedSamples.size() ) ) ) };
+		return sortedSamples[ std::clamp<u64>( rank, 1, sortedSamples.size() ) - 1 ];
+	} // end-of-function: getPercentile
+	
+	
+	
+	// tightly packed RGBA8 texels of per-texel hash noise (which, unlike smooth images, gets no help from the texture cache):
+	[[nodiscard]] std::vector<std::byte>
+	makeNoisePixels( u32 const size )
+	{
+		std::vector<std::byte> pixels( u64{ size } * size * 4 );
+		for ( u32 y{0}; y < size; ++y ) {
+			for ( u32 x{0}; x < size; ++x ) {
+				auto hash { x * 0x9E3779B1u ^ y * 0x85EBCA77u };
+				hash ^= hash >> 15;
+				hash *= 0x2C1B3C6Du;
+				hash ^= hash >> 12;
+				auto *pTexel { &pixels[ (u64{ y } * size + x) * 4 ] };
+				pTexel[0] = static_cast<std::byte>( hash       );
+				pTexel[1] = static_cast<std::byte>( hash >>  8 );
+				pTexel[2] = static_cast<std::byte>( hash >> 16 );
+				pTexel[3] = std::byte { 0xFF };
+			}
+		}
+		return pixels;
+	} // end-of-function: makeNoisePixels
+	
+	
+	
+	[[nodiscard]] Result
+	runScenario( Scenario const &scenario, Options const &options )
+	{
+		fmt::print(
+			"Running scenario `{}` ({} draw(s) per frame, {} frame(s) in flight)...\n",
+			scenario.name, scenario.drawCount, scenario.framesInFlight
+		);
+		
+		gfx::Renderer renderer { gfx::DisplayMode::eHeadless, gfx::RendererConfig { .framesInFlight = scenario.framesInFlight } };
+		auto draw { renderer.getRectangleDrawCommand() };
+		std::unique_ptr<gfx::Texture> pTexture {}; // NOTE: retired (rather than destroyed) once done, since frames may still sample it
+		if ( scenario.texturing != Texturing::eDefault ) {
+			pTexture = renderer.makeTexture(
+				makeNoisePixels( kNoiseTextureSize ),
+				vk::Extent2D { .width = kNoiseTextureSize, .height = kNoiseTextureSize },
+				vk::Format::eR8G8B8A8Srgb,
+				gfx::SamplerCache::kDefaultCreateInfo,
+				scenario.texturing == Texturing::eMipmapped
+			);
+			draw.textureSet = pTexture->getDescriptorSet();
+		}
+		
+		std::vector<f64>            frameMs;
+		std::vector<u64>            frameAllocations;
+		gfx::Renderer::FrameTimings stageTotals {};
+		f64                         gpuTotalMs  { 0 };
+		frameMs         .reserve( options.frameCount );
+		frameAllocations.reserve( options.frameCount );
+		
+		for ( u64 frame{0}; frame < options.warmupCount + options.frameCount; ++frame ) {
+			auto const allocationsBefore { allocationCount.load( std::memory_order_relaxed ) };
+			auto const frameStart        { std::chrono::steady_clock::now() };
+			for ( u32 i{0}; i < scenario.drawCount; ++i )
+				renderer.getDrawList().enqueue( draw );
+			renderer();
+			auto const elapsedMs {
+				std::chrono::duration<f64,std::milli>( std::chrono::steady_clock::now() - frameStart ).count()
+			};
+			if ( frame < options.warmupCount )
+				continue;
+			frameMs.push_back( elapsedMs );
+			frameAllocations.push_back( allocationCount.load( std::memory_order_relaxed ) - allocationsBefore );
+			auto const &stages { renderer.getFrameTimings() };
+			stageTotals.waitMs    += stages.waitMs;
+			stageTotals.acquireMs += stages.acquireMs;
+			stageTotals.recordMs  += stages.recordMs;
+			stageTotals.submitMs  += stages.submitMs;
+			stageTotals.presentMs += stages.presentMs;
+			stageTotals.totalMs   += stages.totalMs;
+			gpuTotalMs            += renderer.getGpuProfiler().getLastFrameMs();
+		}
+		if ( pTexture != nullptr )
+			renderer.retire( std::move( pTexture ) );
+		
+		auto const frameCount { static_cast<f64>( frameMs.size() ) };
+		auto       sortedMs   { frameMs };
+		std::ranges::sort( sortedMs );
+		u64 totalAllocations { 0 };
+		for ( auto const count: frameAllocations )
+			totalAllocations += count;
+		
+		return Result {
+			.name                   = scenario.name,
+			.drawCount              = scenario.drawCount,
+			.framesInFlight         = scenario.framesInFlight,
+			.frameCount             = frameMs.size(),
+			.p50Ms                  = getPercentile( sortedMs, 0.500 ),
+			.p99Ms                  = getPercentile( sortedMs, 0.990 ),
+			.p999Ms                 = getPercentile( sortedMs, 0.999 ),
+			.meanMs                 = std::accumulate( frameMs.begin(), frameMs.end(), 0.0 ) / frameCount,
+			.maxMs                  = sortedMs.back(),
+			.gpuMs                  = gpuTotalMs / frameCount,
+			.meanStages             = gfx::Renderer::FrameTimings {
+			                             .waitMs    = stageTotals.waitMs    / frameCount,
+			                             .acquireMs = stageTotals.acquireMs / frameCount,
+			                             .recordMs  = stageTotals.recordMs  / frameCount,
+			                             .submitMs  = stageTotals.submitMs  / frameCount,
+			                             .presentMs = stageTotals.presentMs / frameCount,
+			                             .totalMs   = stageTotals.totalMs   / frameCount
+			                          },
+			.allocationsPerFrame    = static_cast<f64>( totalAllocations ) / frameCount,
+			.maxAllocationsPerFrame = *std::ranges::max_element( frameAllocations )
+		};
+	} // end-of-function: runScenario
+	
+	
+	
+	// NOTE: Each result is written on a line of its own, which is what `readBaseline` relies on.
+	void
+	writeResults( std::vector<Result> const &results, Options const &options )
+	{
+		std::ofstream file( options.outputPath );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { "Failed to open the benchmark output file!" };
+		file << fmt::format(
+			R"({{"version":"{}.{}.{}","frames":{},"warmup_frames":{},"results":[)" "\n",
+			MYTEMPLATE_VERSION_MAJOR, MYTEMPLATE_VERSION_MINOR, MYTEMPLATE_VERSION_PATCH,
+			options.frameCount, options.warmupCount
+		);
+		for ( u64 i{0}; i < results.size(); ++i ) {
+			auto const &result { results[i] };
+			file << fmt::format(
+				R"({{"name":"{}","draw_count":{},"frames_in_flight":{},"frames":{},)"
+				R"("p50_ms":{:.4f},"p99_ms":{:.4f},"p999_ms":{:.4f},"mean_ms":{:.4f},"max_ms":{:.4f},"gpu_ms":{:.4f},)"
+				R"("wait_ms":{:.4f},"acquire_ms":{:.4f},"record_ms":{:.4f},"submit_ms":{:.4f},"present_ms":{:.4f},)"
+				R"("allocations_per_frame":{:.2f},"max_allocations_per_frame":{}}}{})" "\n",
+				result.name, result.drawCount, result.framesInFlight, result.frameCount,
+				result.p50Ms, result.p99Ms, result.p999Ms, result.meanMs, result.maxMs, result.gpuMs,
+				result.meanStages.waitMs, result.meanStages.acquireMs, result.meanStages.recordMs,
+				result.meanStages.submitMs, result.meanStages.presentMs,
+				result.allocationsPerFrame, result.maxAllocationsPerFrame,
+				i + 1 < results.size() ? "," : ""
+			);
+		}
+		file << "]}\n";
+	} // end-of-function: writeResults
+	
+	
+	
+	// reads the numeric fields of every result in a file previously written by `writeResults`:
+	[[nodiscard]] std::map<std::string,Fields>
+	readBaseline( std::string const &path )
+	{
+		std::ifstream file( path );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { "Failed to open the benchmark baseline file!" };
+		
+		std::regex const namePattern  { R"re("name":"([^"]*)")re" };
+		std::regex const fieldPattern { R"re("(\w+)":(-?[0-9][0-9.eE+-]*))re" };
+		std::map<std::string,Fields> baseline;
+		for ( std::string line; std::getline( file, line ); ) {
+			std::smatch nameMatch;
+			if ( not std::regex_search( line, nameMatch, namePattern ) )
+				continue;
+			auto &fields { baseline[ nameMatch[1].str() ] };
+			for ( std::sregex_iterator it { line.begin(), line.end(), fieldPattern }, end {}; it != end; ++it )
+				fields[ (*it)[1].str() ] = std::stod( (*it)[2].str() );
+		}
+		return baseline;
+	} // end-of-function: readBaseline
+	
+	
+	
+	// returns the number of regressions found (all of which are logged):
+	[[nodiscard]] u64
+	compareWithBaseline( std::vector<Result> const &results, Options const &options )
+	{
+		auto const baseline { readBaseline( *options.baselinePath ) };
+		u64 regressionCount { 0 };
+		auto const check {
+			[&]( Result const &result, Fields const &fields, std::string_view const key, f64 const value, f64 const slack ) {
+				auto const it { fields.find( key ) };
+				if ( it == fields.end() ) [[unlikely]]
+					return;
+				auto const limit { it->second * (1.0 + options.tolerance) + slack };
+				if ( value > limit ) {
+					spdlog::error( "Regression in `{}`: {} is {:.4f} (baseline {:.4f}, limit {:.4f})",
+					               result.name, key, value, it->second, limit );
+					++regressionCount;
+				}
+			}
+		};
+		for ( auto const &result: results ) {
+			auto const it { baseline.find( result.name ) };
+			if ( it == baseline.end() ) [[unlikely]] {
+				spdlog::warn( "No baseline for `{}`; skipping", result.name );
+				continue;
+			}
+			// NOTE: p99.9 is reported but not checked since it's too noisy over a typical frame count (nor is the
+			//       GPU time, which depends on the device far more than on the code; compare it between scenarios)
+			check( result, it->second, "p50_ms",                result.p50Ms,               kTimeSlackMs     );
+			check( result, it->second, "p99_ms",                result.p99Ms,               kTimeSlackMs     );
+			check( result, it->second, "allocations_per_frame", result.allocationsPerFrame, kAllocationSlack );
+		}
+		return regressionCount;
+	} // end-of-function: compareWithBaseline
+	
+	
+	
+	void
+	printUsage()
+	{
+		fmt::print(
+			"Usage: MyTemplateBenchmark [options]\n"
+			"  --frames <n>       measured frames per scenario (default: {})\n"
+			"  --warmup <n>       unmeasured frames per scenario (default: {})\n"
+			"  --output <path>    JSON results (default: benchmark.json)\n"
+			"  --baseline <path>  fail if results regressed compared to this earlier output\n"
+			"  --tolerance <f>    relative regression tolerance (default: {})\n",
+			kDefaultFrameCount, kDefaultWarmupCount, kDefaultTolerance
+		);
+	} // end-of-function: printUsage
+	
+	
+	
+	[[nodiscard]] std::optional<Options>
+	parseOptions( int argc, char const *argv[] )
+	{
+		Options options {};
+		for ( int i{1}; i < argc; ++i ) {
+			std::string_view const arg { argv[i] };
+			bool const hasValue { i + 1 < argc };
+			if      ( arg == "--frames"    and hasValue ) options.frameCount   = std::stoull( argv[++i] );
+			else if ( arg == "--warmup"    and hasValue ) options.warmupCount  = std::stoull( argv[++i] );
+			else if ( arg == "--output"    and hasValue ) options.outputPath   = argv[++i];
+			else if ( arg == "--baseline"  and hasValue ) options.baselinePath = argv[++i];
+			else if ( arg == "--tolerance" and hasValue ) options.tolerance    = std::stod( argv[++i] );
+			else return std::nullopt;
+		}
+		if ( options.frameCount == 0 ) [[unlikely]]
+			return std::nullopt;
+		return options;
+	} // end-of-function: parseOptions
+} // end-of-unnamed-namespace
+
+// NOTE: Replacing the global (unaligned) allocation functions is enough to count allocations;
+//       the array forms forward to these, and the aligned forms are rare enough to ignore.
+// NOTE: Kept out of line so that GCC doesn't flag inlined `free` calls on `new`ed pointers as mismatched.
+[[gnu::noinline]] void *
+operator new( std::size_t size )
+{
+	allocationCount.fetch_add( 1, std::memory_order_relaxed );
+	if ( auto *p { std::malloc( size == 0 ? 1 : size ) }; p ) [[likely]]
+		return p;
+	throw std::bad_alloc {};
+} // end-of-function: operator new
+
+[[gnu::noinline]] void
+operator delete( void *p ) noexcept
+{
+	std::free( p );
+} // end-of-function: operator delete
+
+[[gnu::noinline]] void
+operator delete( void *p, std::size_t ) noexcept
+{
+	std::free( p );
+} // end-of-function: operator delete
+
+int
+main( int argc, char const *argv[] )
+{
+	auto const options { parseOptions( argc, argv ) };
+	if ( not options ) {
+		printUsage();
+		return EXIT_FAILURE;
+	}
+	
+	// NOTE: only warnings and up, so that logging doesn't skew the results
+	logging::initialize( spdlog::level::warn );
+	std::atexit( spdlog::shutdown );
+	
+	if constexpr ( kIsDebugMode )
+		spdlog::warn( "Benchmarking a DEBUG build; results aren't representative!" );
+	
+	try {
+		std::vector<Result> results;
+		results.reserve( kScenarios.size() );
+		for ( auto const &scenario: kScenarios ) {
+			results.push_back( runScenario( scenario, *options ) );
+			auto const &result { results.back() };
+			fmt::print(
+				"{:<19} p50 {:8.3f} ms | p99 {:8.3f} ms | p99.9 {:8.3f} ms | "
+				"wait {:7.3f} | record {:7.3f} | submit {:7.3f} | gpu {:7.3f} ms | {:.2f} alloc(s)/frame\n",
+				result.name, result.p50Ms, result.p99Ms, result.p999Ms,
+				result.meanStages.waitMs, result.meanStages.recordMs, result.meanStages.submitMs, result.gpuMs,
+				result.allocationsPerFrame
+			);
+		}
+		writeResults( results, *options );
+		fmt::print( "Wrote the results to `{}`\n", options->outputPath );
+		
+		if ( options->baselinePath ) {
+			auto const regressionCount { compareWithBaseline( results, *options ) };
+			if ( regressionCount > 0 ) {
+				spdlog::error( "{} regression(s) compared to `{}`!", regressionCount, *options->baselinePath );
+				return EXIT_FAILURE;
+			}
+			fmt::print( "No regressions compared to `{}`\n", *options->baselinePath );
+		}
+	}
+	catch ( vk::SystemError const &e ) {
+		spdlog::critical( "vk::SystemError: {}", e.what() );
+		return EXIT_FAILURE;
+	}
+	catch ( std::exception const &e ) {
+		spdlog::critical( "std::exception: {}", e.what() );
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+} // end-of-function: main
+
+// EOF
@@ -0,0 +1,300 @@
+#include "MyTemplate/Common/AssetPackage.hpp"
+#include "MyTemplate/Common/Profiler.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined( __unix__ ) && !defined( __APPLE__ )
+#	error Unsupported platform! (asset packages are mapped with POSIX `mmap`)
+#endif
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace { // private (file-scope)
+	static_assert( std::endian::native == std::endian::little, "Asset packages are read and written as is (i.e. little-endian)!" );
+	
+	std::array<char,8> constexpr kMagic   { 'M', 'T', 'A', 'S', 'S', 'E', 'T', 'S' };
+	u32                constexpr kVersion { 1 };
+	
+	struct Header final {
+		std::array<char,8> magic;
+		u32                version;
+		u32                assetCount;
+		u64                namesOffset; // NOTE: the table of contents directly follows the header
+		u64                namesSize;
+	}; // end-of-struct: Header
+	static_assert( sizeof(Header) == 32 );
+	
+	// 64-bit FNV-1a, for both the names and the contents.
+	// NOTE: The hashes are stored in the package and the table of contents is sorted by them, so the function is
+	//       part of the file format (i.e. changing it requires repacking).
+	[[nodiscard]] u64
+	hash( std::span<std::byte const> bytes ) noexcept
+	{
+		u64 result { 0xCBF2'9CE4'8422'2325 };
+		for ( auto const byte: bytes )
+			result = (result ^ static_cast<u64>( byte )) * 0x0000'0100'0000'01B3;
+		return result;
+	} // end-of-function: hash
+	
+	[[nodiscard]] u64
+	hash( std::string_view const text ) noexcept
+	{
+		return hash( std::as_bytes( std::span { text } ) );
+	} // end-of-function: hash
+	
+	[[nodiscard]] u64
+	alignUp( u64 const offset ) noexcept
+	{
+		return (offset + AssetPackage::kAlignment - 1) / AssetPackage::kAlignment * AssetPackage::kAlignment;
+	} // end-of-function: alignUp
+} // end-of-unnamed-namespace
+
+struct AssetPackage::TocEntry final {
+	u64 nameHash;
+	u64 contentHash;
+	u64 offset;      // from the start of the package
+	u64 size;
+	u32 nameOffset;  // from the start of the names
+	u32 nameSize;
+}; // end-of-struct: AssetPackage::TocEntry
+
+
+
+AssetPackage::AssetPackage( std::filesystem::path const &path ):
+	mPath        { path    },
+	mpData       { nullptr },
+	mSize        { 0       },
+	mAssetCount  { 0       },
+	mNamesOffset { 0       }
+{
+	PROFILE_FUNCTION();
+	
+	auto const fileDescriptor { ::open( path.c_str(), O_RDONLY | O_CLOEXEC ) };
+	if ( fileDescriptor < 0 ) [[unlikely]]
+		throw std::runtime_error { fmt::format( "Failed to open the asset package `{}`!", path.string() ) };
+	struct ::stat status {};
+	if ( ::fstat( fileDescriptor, &status ) != 0 or status.st_size <= 0 ) [[unlikely]] {
+		::close( fileDescriptor );
+		throw std::runtime_error { fmt::format( "`{}` isn't an asset package!", path.string() ) };
+	}
+	mSize = static_cast<u64>( status.st_size );
+	auto *pMapping { ::mmap( nullptr, mSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 ) };
+	::close( fileDescriptor ); // NOTE: the mapping keeps the file open
+	if ( pMapping == MAP_FAILED ) [[unlikely]]
+		throw std::runtime_error { fmt::format( "Failed to map the asset package `{}`!", path.string() ) };
+	mpData = static_cast<std::byte const *>( pMapping );
+	
+	try {
+		validate();
+	}
+	catch ( ... ) {
+		::munmap( pMapping, mSize ); // NOTE: the destructor won't run
+		throw;
+	}
+} // end-of-function: AssetPackage::AssetPackage
+
+
+
+AssetPackage::~AssetPackage() noexcept
+{
+	::munmap( const_cast<std::byte *>( mpData ), mSize );
+} // end-of-function: AssetPackage::~AssetPackage
+
+
+
+[[nodiscard]] std::optional<std::span<std::byte const>>
+AssetPackage::find( std::string_view const name ) const noexcept
+{
+	for ( auto const &entry: std::ranges::equal_range( getToc(), hash( name ), {}, &TocEntry::nameHash ) ) {
+		if ( getName( entry ) == name ) {
+			std::span const data { mpData + entry.offset, entry.size };
+			assert( hash( data ) == entry.contentHash and "Corrupted asset!" );
+			return data;
+		}
+	}
+	return std::nullopt;
+} // end-of-function: AssetPackage::find
+
+
+
+[[nodiscard]] std::span<std::byte const>
+AssetPackage::get( std::string_view const name ) const
+{
+	if ( auto const data { find( name ) } ) [[likely]]
+		return *data;
+	throw std::runtime_error { fmt::format( "There's no `{}` in the asset package `{}`!", name, mPath.string() ) };
+} // end-of-function: AssetPackage::get
+
+
+
+[[nodiscard]] bool
+AssetPackage::verify() const noexcept
+{
+	return std::ranges::all_of(
+		getToc(),
+		[this]( TocEntry const &entry ) { return hash( std::span { mpData + entry.offset, entry.size } ) == entry.contentHash; }
+	);
+} // end-of-function: AssetPackage::verify
+
+
+
+[[nodiscard]] u32
+AssetPackage::getAssetCount() const noexcept
+{
+	return mAssetCount;
+} // end-of-function: AssetPackage::getAssetCount
+
+
+
+[[nodiscard]] std::filesystem::path const &
+AssetPackage::getPath() const noexcept
+{
+	return mPath;
+} // end-of-function: AssetPackage::getPath
+
+
+
+u32
+AssetPackage::write( std::filesystem::path const &directoryPath, std::filesystem::path const &packagePath )
+{
+	struct Asset final {
+		std::string       name;
+		std::vector<char> contents;
+		TocEntry          entry;
+	}; // end-of-struct: Asset
+	
+	// NOTE: sorted by path so that packing the same files twice gives the same package
+	auto const excludedPath { std::filesystem::weakly_canonical( packagePath ) };
+	std::vector<std::filesystem::path> filePaths;
+	for ( auto const &directoryEntry: std::filesystem::recursive_directory_iterator( directoryPath ) )
+		if ( directoryEntry.is_regular_file() and std::filesystem::weakly_canonical( directoryEntry.path() ) != excludedPath )
+			filePaths.push_back( directoryEntry.path() );
+	std::ranges::sort( filePaths );
+	
+	std::vector<Asset> assets;
+	assets.reserve( filePaths.size() );
+	for ( auto const &filePath: filePaths ) {
+		std::ifstream file( filePath, std::ios::binary | std::ios::ate );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open `{}`!", filePath.string() ) };
+		auto &asset { assets.emplace_back() };
+		asset.name = filePath.lexically_relative( directoryPath ).generic_string();
+		asset.contents.resize( static_cast<std::size_t>( file.tellg() ) );
+		file.seekg( 0 );
+		if ( not file.read( asset.contents.data(), static_cast<std::streamsize>( asset.contents.size() ) ) ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to read `{}`!", filePath.string() ) };
+		asset.entry.nameHash    = hash( asset.name );
+		asset.entry.contentHash = hash( std::as_bytes( std::span { asset.contents } ) );
+		asset.entry.size        = asset.contents.size();
+	}
+	std::ranges::sort( assets, {}, []( Asset const &asset ) { return std::pair { asset.entry.nameHash, std::string_view { asset.name } }; } );
+	
+	// lays out the names and the (aligned) contents:
+	u64 const namesOffset { sizeof(Header) + assets.size() * sizeof(TocEntry) };
+	u64       namesSize   { 0 };
+	for ( auto &asset: assets ) {
+		asset.entry.nameOffset = static_cast<u32>( namesSize );
+		asset.entry.nameSize   = static_cast<u32>( asset.name.size() );
+		namesSize += asset.name.size();
+	}
+	u64 offset { namesOffset + namesSize };
+	for ( auto &asset: assets ) {
+		asset.entry.offset = alignUp( offset );
+		offset = asset.entry.offset + asset.entry.size;
+	}
+	
+	Header const header {
+		.magic       = kMagic,
+		.version     = kVersion,
+		.assetCount  = static_cast<u32>( assets.size() ),
+		.namesOffset = namesOffset,
+		.namesSize   = namesSize
+	};
+	std::ofstream file( packagePath, std::ios::binary );
+	if ( not file ) [[unlikely]]
+		throw std::runtime_error { fmt::format( "Failed to open `{}` for writing!", packagePath.string() ) };
+	file.write( reinterpret_cast<char const *>( &header ), sizeof(Header) );
+	for ( auto const &asset: assets )
+		file.write( reinterpret_cast<char const *>( &asset.entry ), sizeof(TocEntry) );
+	for ( auto const &asset: assets )
+		file.write( asset.name.data(), static_cast<std::streamsize>( asset.name.size() ) );
+	std::array<char,kAlignment> constexpr kPadding {};
+	for ( auto const &asset: assets ) {
+		auto const position { static_cast<u64>( file.tellp() ) };
+		file.write( kPadding.data(), static_cast<std::streamsize>( asset.entry.offset - position ) );
+		file.write( asset.contents.data(), static_cast<std::streamsize>( asset.contents.size() ) );
+	}
+	if ( not file ) [[unlikely]]
+		throw std::runtime_error { fmt::format( "Failed to write `{}`!", packagePath.string() ) };
+	return static_cast<u32>( assets.size() );
+} // end-of-function: AssetPackage::write
+
+
+
+[[nodiscard]] std::span<AssetPackage::TocEntry const>
+AssetPackage::getToc() const noexcept
+{
+	static_assert( sizeof(TocEntry) == 40 );
+	// NOTE: the mapping is page aligned, so the entries (at offset 32) are suitably aligned
+	return { reinterpret_cast<TocEntry const *>( mpData + sizeof(Header) ), mAssetCount };
+} // end-of-function: AssetPackage::getToc
+
+
+
+[[nodiscard]] std::string_view
+AssetPackage::getName( TocEntry const &entry ) const noexcept
+{
+	return { reinterpret_cast<char const *>( mpData + mNamesOffset + entry.nameOffset ), entry.nameSize };
+} // end-of-function: AssetPackage::getName
+
+
+
+void
+AssetPackage::validate()
+{
+	auto const fail {
+		[this]( std::string_view const reason ) {
+			throw std::runtime_error { fmt::format( "`{}` {}!", mPath.string(), reason ) };
+		}
+	};
+	
+	if ( mSize < sizeof(Header) ) [[unlikely]]
+		fail( "isn't an asset package" );
+	Header header;
+	std::memcpy( &header, mpData, sizeof(Header) );
+	if ( header.magic != kMagic ) [[unlikely]]
+		fail( "isn't an asset package" );
+	if ( header.version != kVersion ) [[unlikely]]
+		fail( fmt::format( "has an unsupported version ({}; expected {})", header.version, kVersion ) );
+	auto const tocEnd { sizeof(Header) + u64{ header.assetCount } * sizeof(TocEntry) };
+	if ( tocEnd > mSize or header.namesOffset < tocEnd or header.namesOffset > mSize or header.namesSize > mSize - header.namesOffset ) [[unlikely]]
+		fail( "is truncated" );
+	mAssetCount  = header.assetCount;
+	mNamesOffset = header.namesOffset;
+	
+	auto const toc { getToc() };
+	for ( u32 i{0}; i < toc.size(); ++i ) {
+		auto const &entry { toc[i] };
+		if ( entry.offset % kAlignment != 0 or entry.offset > mSize or entry.size > mSize - entry.offset ) [[unlikely]]
+			fail( "has an asset out of bounds" );
+		if ( u64{ entry.nameOffset } + entry.nameSize > header.namesSize ) [[unlikely]]
+			fail( "has a name out of bounds" );
+		if ( i > 0 and toc[i - 1].nameHash > entry.nameHash ) [[unlikely]]
+			fail( "has an unsorted table of contents" );
+	}
+} // end-of-function: AssetPackage::validate
+// EOF
@@ -0,0 +1,54 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef ASSETPACKAGE_HPP_N4QB7XTM
+#define ASSETPACKAGE_HPP_N4QB7XTM
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+// Read-only archive of assets (e.g. shaders, meshes, textures) that is memory-mapped as a whole.
+// NOTE: Assets are handed out as views into the mapping, so they are read straight from the page cache
+//       (e.g. memcpy'd into staging memory) without any intermediate heap buffers; the views are valid
+//       for as long as the package is. Every asset starts at a multiple of `kAlignment` bytes.
+//       Layout: header, table of contents (sorted by name hash), names, and then the asset data.
+//       Assets are named by their paths relative to the packed directory (e.g. "shaders/test1.vert.spv").
+class AssetPackage final {
+	public:
+		inline static u64 constexpr kAlignment { 64 };
+		
+		explicit AssetPackage( std::filesystem::path const & ); // throws if the package is missing or malformed
+		~AssetPackage() noexcept;
+		AssetPackage(             AssetPackage const &  ) = delete;
+		AssetPackage(             AssetPackage       && ) = delete;
+		AssetPackage & operator=( AssetPackage const &  ) = delete;
+		AssetPackage & operator=( AssetPackage       && ) = delete;
+		
+		// NOTE: in debug builds, the content hash of a found asset is checked (which touches all of its pages)
+		[[nodiscard]] std::optional<std::span<std::byte const>> find( std::string_view const name ) const noexcept;
+		[[nodiscard]] std::span<std::byte const>                get(  std::string_view const name ) const; // throws if not found
+		[[nodiscard]] bool                                      verify()                            const noexcept; // checks every content hash
+		[[nodiscard]] u32                                       getAssetCount()                     const noexcept;
+		[[nodiscard]] std::filesystem::path const &             getPath()                           const noexcept;
+		
+		// packs every regular file in the directory (recursively) into a package; returns the asset count:
+		static u32 write( std::filesystem::path const &directoryPath, std::filesystem::path const &packagePath );
+	
+	private:
+		struct TocEntry;
+		[[nodiscard]] std::span<TocEntry const> getToc()                   const noexcept;
+		[[nodiscard]] std::string_view          getName( TocEntry const & ) const noexcept;
+		void                                    validate(); // also reads the header
+		
+		std::filesystem::path  mPath;
+		std::byte const       *mpData;      // the whole (read-only) mapping
+		u64                    mSize;
+		u32                    mAssetCount;
+		u64                    mNamesOffset;
+}; // end-of-class: AssetPackage
+
+#endif // end-of-header-guard ASSETPACKAGE_HPP_N4QB7XTM
+// EOF
@@ -0,0 +1,560 @@
+#include "MyTemplate/Common/BlockCompression.hpp"
+#include "MyTemplate/Common/WorkerPool.hpp"
+#include "MyTemplate/Common/Profiler.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+// NOTE: The inner loops run over the 16 texels of a block with a fixed channel count and no early outs,
+//       which keeps them simple enough for the compiler to vectorize (no intrinsics are needed).
+
+namespace bc {
+	namespace { // private (file-scope)
+		u32 constexpr kTexelCount          { 16 }; // per block
+		u32 constexpr kPowerIterationCount {  8 }; // for the principal axis of a block's colors
+		
+		std::array constexpr kFormatNames {
+			std::pair { std::string_view { "bc1" }, Format::eBc1 },
+			std::pair { std::string_view { "bc3" }, Format::eBc3 },
+			std::pair { std::string_view { "bc5" }, Format::eBc5 },
+			std::pair { std::string_view { "bc7" }, Format::eBc7 },
+		};
+		
+		// BC7 interpolation weights (out of 64) for 4-bit indices:
+		std::array<i32,16> constexpr kBc7Weights { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+		
+		template <u32 N>
+		using Vector = std::array<f32,N>;
+		
+		template <u32 N>
+		using Color = std::array<i32,N>;
+		
+		// NOTE: BCn blocks are little-endian bit streams; these read and write them as two 64-bit words.
+		using BlockBits = std::array<u64,2>;
+		
+		void
+		putBits( BlockBits &bits, u32 &offset, u64 const value, u32 const count ) noexcept
+		{
+			// pre-condition(s):
+			assert( count <= 32 and offset + count <= 128 );
+			
+			auto const maskedValue { value & ((u64{1} << count) - 1) };
+			auto const word        { offset / 64 };
+			auto const shift       { offset % 64 };
+			bits[word] |= maskedValue << shift;
+			if ( shift + count > 64 )
+				bits[word + 1] |= maskedValue >> (64 - shift);
+			offset += count;
+		} // end-of-function: putBits
+		
+		[[nodiscard]] u64
+		getBits( BlockBits const &bits, u32 &offset, u32 const count ) noexcept
+		{
+			// pre-condition(s):
+			assert( count <= 32 and offset + count <= 128 );
+			
+			auto const word  { offset / 64 };
+			auto const shift { offset % 64 };
+			u64 value { bits[word] >> shift };
+			if ( shift + count > 64 )
+				value |= bits[word + 1] << (64 - shift);
+			offset += count;
+			return value & ((u64{1} << count) - 1);
+		} // end-of-function: getBits
+		
+		void
+		storeBits( BlockBits const &bits, std::span<u8> bytes ) noexcept
+		{
+			for ( u32 i{0}; i < bytes.size(); ++i )
+				bytes[i] = static_cast<u8>( bits[i / 8] >> (8 * (i % 8)) );
+		} // end-of-function: storeBits
+		
+		[[nodiscard]] BlockBits
+		loadBits( std::span<u8 const> bytes ) noexcept
+		{
+			BlockBits bits { 0, 0 };
+			for ( u32 i{0}; i < bytes.size(); ++i )
+				bits[i / 8] |= u64{ bytes[i] } << (8 * (i % 8));
+			return bits;
+		} // end-of-function: loadBits
+		
+		// fits a line through the first N channels of the texels (along their principal axis)
+		// and returns the extreme points of the texels projected onto it:
+		template <u32 N>
+		[[nodiscard]] std::array<Vector<N>,2>
+		fitEndpoints( Texels const &texels ) noexcept
+		{
+			Vector<N> mean {};
+			Vector<N> low  {};
+			Vector<N> high {};
+			low.fill( 255.0f );
+			for ( u32 i{0}; i < kTexelCount; ++i ) {
+				for ( u32 c{0}; c < N; ++c ) {
+					auto const value { static_cast<f32>( texels[i*4+c] ) };
+					mean[c] += value;
+					low[c]   = std::min( low[c],  value );
+					high[c]  = std::max( high[c], value );
+				}
+			}
+			for ( auto &value: mean )
+				value /= static_cast<f32>( kTexelCount );
+			
+			std::array<Vector<N>,N> covariance {};
+			for ( u32 i{0}; i < kTexelCount; ++i ) {
+				Vector<N> delta;
+				for ( u32 c{0}; c < N; ++c )
+					delta[c] = static_cast<f32>( texels[i*4+c] ) - mean[c];
+				for ( u32 a{0}; a < N; ++a )
+					for ( u32 b{0}; b < N; ++b )
+						covariance[a][b] += delta[a] * delta[b];
+			}
+			
+			// power iteration, starting from the diagonal of the bounding box:
+			Vector<N> axis;
+			f32       axisLengthSquared { 0 };
+			for ( u32 c{0}; c < N; ++c ) {
+				axis[c]            = high[c] - low[c];
+				axisLengthSquared += axis[c] * axis[c];
+			}
+			if ( axisLengthSquared == 0 ) // i.e. a single color
+				return { mean, mean };
+			for ( u32 iteration{0}; iteration < kPowerIterationCount; ++iteration ) {
+				Vector<N> next {};
+				for ( u32 a{0}; a < N; ++a )
+					for ( u32 b{0}; b < N; ++b )
+						next[a] += covariance[a][b] * axis[b];
+				f32 largest { 0 };
+				for ( auto const value: next )
+					largest = std::max( largest, std::abs( value ) );
+				if ( largest < 1e-6f ) [[unlikely]]
+					break;
+				for ( u32 c{0}; c < N; ++c )
+					axis[c] = next[c] / largest; // NOTE: any scale will do; this avoids a square root
+			}
+			axisLengthSquared = 0;
+			for ( auto const value: axis )
+				axisLengthSquared += value * value;
+			
+			f32 lowest  { std::numeric_limits<f32>::max()    };
+			f32 highest { std::numeric_limits<f32>::lowest() };
+			for ( u32 i{0}; i < kTexelCount; ++i ) {
+				f32 projection { 0 };
+				for ( u32 c{0}; c < N; ++c )
+					projection += (static_cast<f32>( texels[i*4+c] ) - mean[c]) * axis[c];
+				lowest  = std::min( lowest,  projection );
+				highest = std::max( highest, projection );
+			}
+			
+			std::array<Vector<N>,2> endpoints;
+			for ( u32 c{0}; c < N; ++c ) {
+				endpoints[0][c] = std::clamp( mean[c] + axis[c] * highest / axisLengthSquared, 0.0f, 255.0f );
+				endpoints[1][c] = std::clamp( mean[c] + axis[c] * lowest  / axisLengthSquared, 0.0f, 255.0f );
+			}
+			return endpoints;
+		} // end-of-function: fitEndpoints
+		
+		// returns the index of the palette entry closest to each texel (by squared distance over the first N channels):
+		template <u32 N, std::size_t kPaletteSize>
+		[[nodiscard]] std::array<u32,kTexelCount>
+		selectIndices( Texels const &texels, std::array<Color<N>,kPaletteSize> const &palette ) noexcept
+		{
+			std::array<u32,kTexelCount> indices;
+			for ( u32 i{0}; i < kTexelCount; ++i ) {
+				i32 bestDistance { std::numeric_limits<i32>::max() };
+				for ( u32 entry{0}; entry < kPaletteSize; ++entry ) {
+					i32 distance { 0 };
+					for ( u32 c{0}; c < N; ++c ) {
+						auto const delta { static_cast<i32>( texels[i*4+c] ) - palette[entry][c] };
+						distance += delta * delta;
+					}
+					if ( distance < bestDistance ) {
+						bestDistance = distance;
+						indices[i]   = entry;
+					}
+				}
+			}
+			return indices;
+		} // end-of-function: selectIndices
+		
+		[[nodiscard]] u16
+		toRgb565( Vector<3> const &color ) noexcept
+		{
+			auto const quantize {
+				[]( f32 const value, f32 const maxValue ) {
+					return static_cast<u16>( std::lround( value * maxValue / 255.0f ) );
+				}
+			};
+			return static_cast<u16>( quantize( color[0], 31 ) << 11 | quantize( color[1], 63 ) << 5 | quantize( color[2], 31 ) );
+		} // end-of-function: toRgb565
+		
+		[[nodiscard]] Color<4>
+		fromRgb565( u16 const color ) noexcept
+		{
+			i32 const r { (color >> 11) & 0x1F };
+			i32 const g { (color >>  5) & 0x3F };
+			i32 const b {  color        & 0x1F };
+			return { (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 255 };
+		} // end-of-function: fromRgb565
+		
+		// the colors of a BC1 block (also used by BC3), always in the 4 color mode:
+		void
+		encodeColorBlock( Texels const &texels, std::span<u8> block ) noexcept
+		{
+			auto const endpoints { fitEndpoints<3>( texels ) };
+			auto       color0    { toRgb565( endpoints[0] ) };
+			auto       color1    { toRgb565( endpoints[1] ) };
+			if ( color0 < color1 )
+				std::swap( color0, color1 ); // NOTE: color0 > color1 selects the 4 color mode in BC1
+			
+			u32 indexBits { 0 }; // NOTE: equal endpoints leave every index at 0 (which is correct in both modes)
+			if ( color0 != color1 ) {
+				auto const c0 { fromRgb565( color0 ) };
+				auto const c1 { fromRgb565( color1 ) };
+				std::array<Color<3>,4> palette;
+				for ( u32 c{0}; c < 3; ++c ) {
+					palette[0][c] = c0[c];
+					palette[1][c] = c1[c];
+					palette[2][c] = (2 * c0[c] +     c1[c]) / 3;
+					palette[3][c] = (    c0[c] + 2 * c1[c]) / 3;
+				}
+				auto const indices { selectIndices<3>( texels, palette ) };
+				for ( u32 i{0}; i < kTexelCount; ++i )
+					indexBits |= indices[i] << (2 * i);
+			}
+			
+			block[0] = static_cast<u8>( color0      );
+			block[1] = static_cast<u8>( color0 >> 8 );
+			block[2] = static_cast<u8>( color1      );
+			block[3] = static_cast<u8>( color1 >> 8 );
+			for ( u32 i{0}; i < 4; ++i )
+				block[4 + i] = static_cast<u8>( indexBits >> (8 * i) );
+		} // end-of-function: encodeColorBlock
+		
+		void
+		decodeColorBlock( std::span<u8 const> block, Texels &texels, bool const isFourColorModeForced ) noexcept
+		{
+			auto const color0 { static_cast<u16>( block[0] | block[1] << 8 ) };
+			auto const color1 { static_cast<u16>( block[2] | block[3] << 8 ) };
+			auto const c0     { fromRgb565( color0 ) };
+			auto const c1     { fromRgb565( color1 ) };
+			
+			std::array<Color<4>,4> palette { c0, c1 };
+			if ( color0 > color1 or isFourColorModeForced ) {
+				for ( u32 c{0}; c < 3; ++c ) {
+					palette[2][c] = (2 * c0[c] +     c1[c]) / 3;
+					palette[3][c] = (    c0[c] + 2 * c1[c]) / 3;
+				}
+				palette[2][3] = palette[3][3] = 255;
+			}
+			else { // the 3 color mode, where the last entry is transparent black:
+				for ( u32 c{0}; c < 3; ++c )
+					palette[2][c] = (c0[c] + c1[c]) / 2;
+				palette[2][3] = 255;
+				palette[3]    = { 0, 0, 0, 0 };
+			}
+			
+			auto const indexBits { static_cast<u32>( block[4] | block[5] << 8 | block[6] << 16 | static_cast<u32>( block[7] ) << 24 ) };
+			for ( u32 i{0}; i < kTexelCount; ++i )
+				for ( u32 c{0}; c < 4; ++c )
+					texels[i*4+c] = static_cast<u8>( palette[(indexBits >> (2 * i)) & 0x3][c] );
+		} // end-of-function: decodeColorBlock
+		
+		// a single channel of the texels as a BC4 block (used by BC3 for alpha and twice by BC5), in the 8 value mode:
+		void
+		encodeChannelBlock( Texels const &texels, u32 const channel, std::span<u8> block ) noexcept
+		{
+			i32 low  { 255 };
+			i32 high {   0 };
+			for ( u32 i{0}; i < kTexelCount; ++i ) {
+				low  = std::min<i32>( low,  texels[i*4+channel] );
+				high = std::max<i32>( high, texels[i*4+channel] );
+			}
+			
+			u64 indexBits { 0 };
+			if ( high > low ) { // NOTE: value0 > value1 selects the 8 value mode
+				auto const range { high - low };
+				for ( u32 i{0}; i < kTexelCount; ++i ) {
+					// the position (from 0 at the high end to 7 at the low end) is reordered into an index:
+					auto const position { ((high - texels[i*4+channel]) * 7 + range / 2) / range };
+					auto const index    { position == 0 ? 0 : position == 7 ? 1 : position + 1 };
+					indexBits |= static_cast<u64>( index ) << (3 * i);
+				}
+			}
+			
+			block[0] = static_cast<u8>( high );
+			block[1] = static_cast<u8>( low  );
+			for ( u32 i{0}; i < 6; ++i )
+				block[2 + i] = static_cast<u8>( indexBits >> (8 * i) );
+		} // end-of-function: encodeChannelBlock
+		
+		void
+		decodeChannelBlock( std::span<u8 const> block, u32 const channel, Texels &texels ) noexcept
+		{
+			i32 const value0 { block[0] };
+			i32 const value1 { block[1] };
+			std::array<i32,8> palette { value0, value1 };
+			if ( value0 > value1 ) {
+				for ( u32 i{2}; i < 8; ++i )
+					palette[i] = ((8 - static_cast<i32>( i )) * value0 + (static_cast<i32>( i ) - 1) * value1 + 3) / 7;
+			}
+			else { // the 6 value mode, where the last two entries are 0 and 255:
+				for ( u32 i{2}; i < 6; ++i )
+					palette[i] = ((6 - static_cast<i32>( i )) * value0 + (static_cast<i32>( i ) - 1) * value1 + 2) / 5;
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+			
+			u64 indexBits { 0 };
+			for ( u32 i{0}; i < 6; ++i )
+				indexBits |= u64{ block[2 + i] } << (8 * i);
+			for ( u32 i{0}; i < kTexelCount; ++i )
+				texels[i*4+channel] = static_cast<u8>( palette[(indexBits >> (3 * i)) & 0x7] );
+		} // end-of-function: decodeChannelBlock
+		
+		// BC7 mode 6: a single subset of RGBA endpoints (7 bits per channel plus a p-bit per endpoint) and 4-bit indices.
+		void
+		encodeBc7Block( Texels const &texels, std::span<u8> block ) noexcept
+		{
+			auto const endpoints { fitEndpoints<4>( texels ) };
+			
+			// quantizes each endpoint, picking whichever p-bit (i.e. shared lowest bit) fits it best:
+			std::array<Color<4>,2> quantized;
+			std::array<u32,2>      pBits;
+			for ( u32 e{0}; e < 2; ++e ) {
+				f32 bestError { std::numeric_limits<f32>::max() };
+				for ( u32 pBit{0}; pBit < 2; ++pBit ) {
+					Color<4> candidate;
+					f32      error { 0 };
+					for ( u32 c{0}; c < 4; ++c ) {
+						candidate[c] = std::clamp( static_cast<i32>( std::lround( (endpoints[e][c] - static_cast<f32>( pBit )) / 2.0f ) ), 0, 127 );
+						auto const delta { static_cast<f32>( candidate[c] << 1 | static_cast<i32>( pBit ) ) - endpoints[e][c] };
+						error += delta * delta;
+					}
+					if ( error < bestError ) {
+						bestError    = error;
+						quantized[e] = candidate;
+						pBits[e]     = pBit;
+					}
+				}
+			}
+			
+			std::array<Color<4>,16> palette;
+			for ( u32 entry{0}; entry < 16; ++entry ) {
+				for ( u32 c{0}; c < 4; ++c ) {
+					auto const value0 { quantized[0][c] << 1 | static_cast<i32>( pBits[0] ) };
+					auto const value1 { quantized[1][c] << 1 | static_cast<i32>( pBits[1] ) };
+					palette[entry][c] = ((64 - kBc7Weights[entry]) * value0 + kBc7Weights[entry] * value1 + 32) >> 6;
+				}
+			}
+			auto indices { selectIndices<4>( texels, palette ) };
+			
+			// the first index is stored without its top bit (i.e. it has to be < 8), which swapping the endpoints ensures:
+			if ( indices[0] >= 8 ) {
+				std::swap( quantized[0], quantized[1] );
+				std::swap( pBits[0],     pBits[1]     );
+				for ( auto &index: indices )
+					index = 15 - index; // NOTE: the weights are symmetric
+			}
+			
+			BlockBits bits   { 0, 0 };
+			u32       offset { 0 };
+			putBits( bits, offset, 1 << 6, 7 ); // i.e. mode 6 (as 6 zero bits followed by a one bit)
+			for ( u32 c{0}; c < 4; ++c )
+				for ( u32 e{0}; e < 2; ++e )
+					putBits( bits, offset, static_cast<u64>( quantized[e][c] ), 7 );
+			putBits( bits, offset, pBits[0], 1 );
+			putBits( bits, offset, pBits[1], 1 );
+			for ( u32 i{0}; i < kTexelCount; ++i )
+				putBits( bits, offset, indices[i], i == 0 ? 3 : 4 );
+			assert( offset == 128 );
+			storeBits( bits, block.first( 16 ) );
+		} // end-of-function: encodeBc7Block
+		
+		void
+		decodeBc7Block( std::span<u8 const> block, Texels &texels )
+		{
+			if ( (block[0] & 0x7F) != 1 << 6 ) [[unlikely]]
+				throw std::runtime_error { "Unsupported BC7 block mode (only mode 6 can be decoded)!" };
+			
+			auto const bits   { loadBits( block.first( 16 ) ) };
+			u32        offset { 7 };
+			std::array<Color<4>,2> endpoints;
+			for ( u32 c{0}; c < 4; ++c )
+				for ( u32 e{0}; e < 2; ++e )
+					endpoints[e][c] = static_cast<i32>( getBits( bits, offset, 7 ) ) << 1;
+			for ( u32 e{0}; e < 2; ++e ) {
+				auto const pBit { static_cast<i32>( getBits( bits, offset, 1 ) ) };
+				for ( u32 c{0}; c < 4; ++c )
+					endpoints[e][c] |= pBit;
+			}
+			for ( u32 i{0}; i < kTexelCount; ++i ) {
+				auto const weight { kBc7Weights[ getBits( bits, offset, i == 0 ? 3 : 4 ) ] };
+				for ( u32 c{0}; c < 4; ++c )
+					texels[i*4+c] = static_cast<u8>( ((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6 );
+			}
+		} // end-of-function: decodeBc7Block
+		
+		// copies the texels of a block out of an image, repeating the edge texels past the edges:
+		void
+		gatherBlock( std::span<u8 const> rgba, u32 const width, u32 const height, u32 const blockX, u32 const blockY, Texels &texels ) noexcept
+		{
+			for ( u32 y{0}; y < 4; ++y ) {
+				auto const imageY { std::min( blockY * 4 + y, height - 1 ) };
+				for ( u32 x{0}; x < 4; ++x ) {
+					auto const imageX { std::min( blockX * 4 + x, width - 1 ) };
+					std::memcpy( &texels[(y * 4 + x) * 4], &rgba[(u64{ imageY } * width + imageX) * 4], 4 );
+				}
+			}
+		} // end-of-function: gatherBlock
+	} // end-of-unnamed-namespace
+	
+	
+	
+	[[nodiscard]] u32
+	getBlockByteSize( Format const format ) noexcept
+	{
+		return format == Format::eBc1 ? 8 : 16;
+	} // end-of-function: bc::getBlockByteSize
+	
+	
+	
+	[[nodiscard]] u64
+	getImageByteSize( Format const format, u32 const width, u32 const height ) noexcept
+	{
+		return u64{ (width + 3) / 4 } * u64{ (height + 3) / 4 } * getBlockByteSize( format );
+	} // end-of-function: bc::getImageByteSize
+	
+	
+	
+	[[nodiscard]] std::string_view
+	getName( Format const format ) noexcept
+	{
+		auto const it { std::ranges::find( kFormatNames, format, &std::pair<std::string_view,Format>::second ) };
+		return it == kFormatNames.end() ? "?" : it->first;
+	} // end-of-function: bc::getName
+	
+	
+	
+	[[nodiscard]] std::optional<Format>
+	parseFormat( std::string_view const name ) noexcept
+	{
+		auto const it { std::ranges::find( kFormatNames, name, &std::pair<std::string_view,Format>::first ) };
+		if ( it == kFormatNames.end() ) [[unlikely]]
+			return std::nullopt;
+		return it->second;
+	} // end-of-function: bc::parseFormat
+	
+	
+	
+	void
+	encodeBlock( Format const format, Texels const &texels, std::span<u8> block ) noexcept
+	{
+		// pre-condition(s):
+		assert( block.size() >= getBlockByteSize( format ) );
+		
+		switch ( format ) {
+			case Format::eBc1: encodeColorBlock( texels, block ); break;
+			case Format::eBc3: encodeChannelBlock( texels, 3, block.first( 8 ) ); encodeColorBlock(      texels,    block.subspan( 8 ) ); break;
+			case Format::eBc5: encodeChannelBlock( texels, 0, block.first( 8 ) ); encodeChannelBlock( texels, 1, block.subspan( 8 ) ); break;
+			case Format::eBc7: encodeBc7Block( texels, block ); break;
+		}
+	} // end-of-function: bc::encodeBlock
+	
+	
+	
+	void
+	decodeBlock( Format const format, std::span<u8 const> block, Texels &texels )
+	{
+		// pre-condition(s):
+		assert( block.size() >= getBlockByteSize( format ) );
+		
+		switch ( format ) {
+			case Format::eBc1:
+				decodeColorBlock( block, texels, false );
+				break;
+			case Format::eBc3:
+				decodeColorBlock( block.subspan( 8 ), texels, true ); // NOTE: BC3 colors are always in the 4 color mode
+				decodeChannelBlock( block.first( 8 ), 3, texels );
+				break;
+			case Format::eBc5:
+				for ( u32 i{0}; i < kTexelCount; ++i ) {
+					texels[i*4+2] = 0;
+					texels[i*4+3] = 255;
+				}
+				decodeChannelBlock( block.first(   8 ), 0, texels );
+				decodeChannelBlock( block.subspan( 8 ), 1, texels );
+				break;
+			case Format::eBc7:
+				decodeBc7Block( block, texels );
+				break;
+		}
+	} // end-of-function: bc::decodeBlock
+	
+	
+	
+	[[nodiscard]] std::vector<u8>
+	encodeImage( Format const format, std::span<u8 const> rgba, u32 const width, u32 const height, WorkerPool *pWorkerPool )
+	{
+		PROFILE_FUNCTION();
+		
+		// pre-condition(s):
+		assert( width > 0 and height > 0 );
+		assert( rgba.size() >= u64{ width } * height * 4 );
+		
+		auto const blockCountX    { (width  + 3) / 4 };
+		auto const blockCountY    { (height + 3) / 4 };
+		auto const blockByteSize  { getBlockByteSize( format ) };
+		std::vector<u8> blocks( getImageByteSize( format, width, height ) );
+		auto const encodeRow {
+			[&]( u32 const blockY, [[maybe_unused]] u32 const workerIndex ) {
+				Texels texels;
+				for ( u32 blockX{0}; blockX < blockCountX; ++blockX ) {
+					gatherBlock( rgba, width, height, blockX, blockY, texels );
+					auto const blockIndex { u64{ blockY } * blockCountX + blockX };
+					encodeBlock( format, texels, std::span { blocks }.subspan( blockIndex * blockByteSize, blockByteSize ) );
+				}
+			}
+		};
+		if ( pWorkerPool != nullptr )
+			pWorkerPool->parallelFor( blockCountY, encodeRow );
+		else for ( u32 blockY{0}; blockY < blockCountY; ++blockY )
+			encodeRow( blockY, 0 );
+		return blocks;
+	} // end-of-function: bc::encodeImage
+	
+	
+	
+	[[nodiscard]] std::vector<u8>
+	decodeImage( Format const format, std::span<u8 const> blocks, u32 const width, u32 const height )
+	{
+		PROFILE_FUNCTION();
+		
+		if ( blocks.size() < getImageByteSize( format, width, height ) ) [[unlikely]]
+			throw std::runtime_error { "Too little block compressed data for the image extent!" };
+		
+		auto const blockCountX   { (width  + 3) / 4 };
+		auto const blockCountY   { (height + 3) / 4 };
+		auto const blockByteSize { getBlockByteSize( format ) };
+		std::vector<u8> rgba( u64{ width } * height * 4 );
+		Texels texels;
+		for ( u32 blockY{0}; blockY < blockCountY; ++blockY ) {
+			for ( u32 blockX{0}; blockX < blockCountX; ++blockX ) {
+				auto const blockIndex { u64{ blockY } * blockCountX + blockX };
+				decodeBlock( format, blocks.subspan( blockIndex * blockByteSize, blockByteSize ), texels );
+				// copies the texels that are within the image (i.e. the padding of edge blocks is dropped):
+				for ( u32 y{0}; y < 4 and blockY * 4 + y < height; ++y )
+					for ( u32 x{0}; x < 4 and blockX * 4 + x < width; ++x )
+						std::memcpy( &rgba[(u64{ blockY * 4 + y } * width + blockX * 4 + x) * 4], &texels[(y * 4 + x) * 4], 4 );
+			}
+		}
+		return rgba;
+	} // end-of-function: bc::decodeImage
+} // end-of-namespace: bc
+// EOF
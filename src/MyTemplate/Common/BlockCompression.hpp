@@ -0,0 +1,42 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef BLOCKCOMPRESSION_HPP_W5HD2KQN
+#define BLOCKCOMPRESSION_HPP_W5HD2KQN
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <array>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+class WorkerPool;
+
+// CPU encoder and decoder for the BCn block compressed texture formats; images are tightly packed RGBA8.
+// NOTE: Every format compresses 4x4 texel blocks (edge blocks are padded by repeating the edge texels).
+//       The encoder aims for speed over quality: endpoints are fit along the principal axis of each block.
+//         BC1: RGB, 8 bytes per block (always in the opaque 4 color mode)
+//         BC3: RGBA, 16 bytes per block (BC1 color plus a BC4 alpha block)
+//         BC5: RG, 16 bytes per block (two BC4 blocks; e.g. for normal maps, decoded with B = 0 and A = 255)
+//         BC7: RGBA, 16 bytes per block (only mode 6 is encoded and decoded)
+namespace bc {
+	enum class Format : u8 { eBc1, eBc3, eBc5, eBc7 };
+	
+	using Texels = std::array<u8,4*4*4>; // one block of RGBA8 texels in row-major order
+	
+	[[nodiscard]] u32                   getBlockByteSize( Format const ) noexcept;
+	[[nodiscard]] u64                   getImageByteSize( Format const, u32 const width, u32 const height ) noexcept;
+	[[nodiscard]] std::string_view      getName(          Format const ) noexcept;
+	[[nodiscard]] std::optional<Format> parseFormat( std::string_view const name ) noexcept; // e.g. "bc7"
+	
+	// `block` has to hold (at least) `getBlockByteSize` bytes:
+	void encodeBlock( Format const, Texels const &, std::span<u8> block ) noexcept;
+	void decodeBlock( Format const, std::span<u8 const> block, Texels & ); // throws on unsupported BC7 modes
+	
+	// the rows of blocks are encoded in parallel if a worker pool is given:
+	[[nodiscard]] std::vector<u8> encodeImage( Format const, std::span<u8 const> rgba, u32 const width, u32 const height, WorkerPool * = nullptr );
+	[[nodiscard]] std::vector<u8> decodeImage( Format const, std::span<u8 const> blocks, u32 const width, u32 const height );
+} // end-of-namespace: bc
+
+#endif // end-of-header-guard BLOCKCOMPRESSION_HPP_W5HD2KQN
+// EOF
@@ -0,0 +1,43 @@
+#include "MyTemplate/Common/Logging.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <spdlog/spdlog.h>
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace logging {
+	namespace { // private (file-scope)
+		u64 constexpr kQueueSize { 8192 }; // messages
+	} // end-of-unnamed-namespace
+	
+	
+	
+	void
+	initialize( spdlog::level::level_enum const runTimeLevel )
+	{
+		spdlog::init_thread_pool( kQueueSize, 1 );
+		// NOTE: When the queue is full the oldest messages are dropped rather than blocking the
+		//       logging thread, since a stalled render loop is worse than a truncated log.
+		auto pLogger { spdlog::stdout_color_mt<spdlog::async_factory_nonblock>( "MyTemplate" ) };
+		pLogger->set_level( runTimeLevel );
+		pLogger->flush_on( spdlog::level::err );
+		spdlog::set_default_logger( std::move( pLogger ) );
+	} // end-of-function: initialize
+	
+	
+	
+	[[nodiscard]] std::optional<spdlog::level::level_enum>
+	parseLevel( std::string_view const name )
+	{
+		auto const level { spdlog::level::from_str( std::string { name } ) };
+		// NOTE: `from_str` maps unknown names to `off`
+		if ( level == spdlog::level::off and name != "off" ) [[unlikely]]
+			return std::nullopt;
+		return level;
+	} // end-of-function: parseLevel
+} // end-of-namespace: logging
+// EOF
@@ -0,0 +1,45 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef LOGGING_HPP_H5TQ9WEM
+#define LOGGING_HPP_H5TQ9WEM
+
+#include <spdlog/spdlog.h>
+
+#include <optional>
+#include <string_view>
+
+// NOTE: Levels below `LOG_COMPILE_LEVEL` are compiled out entirely; levels at or above it are checked
+//       against the run-time level *before* the arguments are evaluated, so a disabled log statement
+//       costs one branch and never formats (or even computes) its arguments.
+//       Defaults to trace in debug builds and info in release builds; define it to override.
+#if !defined( LOG_COMPILE_LEVEL )
+#	if !defined( NDEBUG )
+#		define LOG_COMPILE_LEVEL SPDLOG_LEVEL_TRACE
+#	else
+#		define LOG_COMPILE_LEVEL SPDLOG_LEVEL_INFO
+#	endif
+#endif
+
+#define LOG_AT( level, ... )                                            \
+	do {                                                                \
+		if constexpr ( static_cast<int>( level ) >= LOG_COMPILE_LEVEL ) \
+			if ( spdlog::should_log( level ) ) [[unlikely]]             \
+				spdlog::log( level, __VA_ARGS__ );                      \
+	} while ( false )
+
+#define LOG_TRACE( ... ) LOG_AT( spdlog::level::trace, __VA_ARGS__ )
+#define LOG_DEBUG( ... ) LOG_AT( spdlog::level::debug, __VA_ARGS__ )
+#define LOG_INFO(  ... ) LOG_AT( spdlog::level::info,  __VA_ARGS__ )
+#define LOG_WARN(  ... ) LOG_AT( spdlog::level::warn,  __VA_ARGS__ )
+#define LOG_ERROR( ... ) LOG_AT( spdlog::level::err,   __VA_ARGS__ )
+
+namespace logging {
+	// Replaces the default logger with one that formats and writes on a background thread;
+	// errors and worse are flushed immediately. Call once, before any other thread logs.
+	void initialize( spdlog::level::level_enum const runTimeLevel );
+	
+	// parses a level name as accepted by `--log-level` (e.g. "debug", "warn", "off"):
+	[[nodiscard]] std::optional<spdlog::level::level_enum> parseLevel( std::string_view const name );
+} // end-of-namespace: logging
+
+#endif // end-of-header-guard LOGGING_HPP_H5TQ9WEM
+// EOF
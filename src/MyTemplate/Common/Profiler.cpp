@@ -0,0 +1,191 @@
+#include "MyTemplate/Common/Profiler.hpp"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace profiler {
+	namespace { // private (file-scope)
+		u64 constexpr kRingCapacity { 1 << 15 }; // zones per thread (~1 MiB per thread)
+		
+		// NOTE: The fields are atomics only so that a snapshot may be taken while the owning thread keeps
+		//       recording; all accesses are relaxed and ordered by the ring's claim and write counts.
+		struct Slot final {
+			std::atomic<char const *> name    { nullptr };
+			std::atomic<u64>          beginNs { 0       };
+			std::atomic<u64>          endNs   { 0       };
+		}; // end-of-struct: Slot
+		
+		// Single-producer ring; only the owning thread writes, any thread may take a snapshot.
+		struct ThreadRing final {
+			explicit ThreadRing( u32 const threadId ):
+				threadId   { threadId                                 },
+				pSlots     { std::make_unique<Slot[]>( kRingCapacity ) },
+				claimCount { 0                                        },
+				writeCount { 0                                        }
+			{}
+			
+			u32                     threadId;
+			std::string             name;       // guarded by the registry mutex
+			std::unique_ptr<Slot[]> pSlots;
+			std::atomic<u64>        claimCount; // bumped before a slot is (over)written
+			std::atomic<u64>        writeCount; // bumped after a slot is written (i.e. the number of complete zones)
+		}; // end-of-struct: ThreadRing
+		
+		// NOTE: The rings are shared so that they outlive their threads (e.g. joined workers) until exported.
+		struct Registry final {
+			std::mutex                               mutex;
+			std::vector<std::shared_ptr<ThreadRing>> rings;
+		}; // end-of-struct: Registry
+		
+		[[nodiscard]] Registry &
+		getRegistry()
+		{
+			static Registry registry {};
+			return registry;
+		} // end-of-function: getRegistry
+		
+		[[nodiscard]] ThreadRing &
+		getThreadRing()
+		{
+			thread_local std::shared_ptr<ThreadRing> const pRing {
+				[] {
+					auto &registry { getRegistry() };
+					std::scoped_lock lock { registry.mutex };
+					auto pNewRing { std::make_shared<ThreadRing>( static_cast<u32>( registry.rings.size() ) ) };
+					registry.rings.push_back( pNewRing );
+					return pNewRing;
+				}()
+			};
+			return *pRing;
+		} // end-of-function: getThreadRing
+		
+		void
+		record( char const *name, u64 const beginNs, u64 const endNs ) noexcept
+		{
+			auto       &ring  { getThreadRing() };
+			auto const  index { ring.writeCount.load( std::memory_order_relaxed ) };
+			auto       &slot  { ring.pSlots[index % kRingCapacity] };
+			ring.claimCount.store( index + 1, std::memory_order_relaxed );
+			std::atomic_thread_fence( std::memory_order_release ); // orders the claim before the slot writes
+			slot.name   .store( name,    std::memory_order_relaxed );
+			slot.beginNs.store( beginNs, std::memory_order_relaxed );
+			slot.endNs  .store( endNs,   std::memory_order_relaxed );
+			ring.writeCount.store( index + 1, std::memory_order_release ); // publishes the slot
+		} // end-of-function: record
+		
+		// copies the zones of a ring that are guaranteed not to have been overwritten during the copy:
+		[[nodiscard]] std::vector<Zone>
+		takeSnapshot( ThreadRing const &ring )
+		{
+			auto const endIndex   { ring.writeCount.load( std::memory_order_acquire ) };
+			auto const beginIndex { endIndex > kRingCapacity ? endIndex - kRingCapacity : 0 };
+			std::vector<Zone> zones;
+			zones.reserve( endIndex - beginIndex );
+			for ( auto index { beginIndex }; index < endIndex; ++index ) {
+				auto const &slot { ring.pSlots[index % kRingCapacity] };
+				zones.push_back({
+					.name    = slot.name   .load( std::memory_order_relaxed ),
+					.beginNs = slot.beginNs.load( std::memory_order_relaxed ),
+					.endNs   = slot.endNs  .load( std::memory_order_relaxed )
+				});
+			}
+			std::atomic_thread_fence( std::memory_order_acquire );
+			// NOTE: any zone the owner might have started overwriting in the meantime is discarded:
+			auto const claimCount { ring.claimCount.load( std::memory_order_relaxed ) };
+			auto const tornCount  {
+				claimCount > beginIndex + kRingCapacity
+				? std::min<u64>( claimCount - kRingCapacity - beginIndex, zones.size() )
+				: 0
+			};
+			zones.erase( zones.begin(), zones.begin() + static_cast<i64>( tornCount ) );
+			return zones;
+		} // end-of-function: takeSnapshot
+	} // end-of-unnamed-namespace
+	
+	
+	
+	ScopedZone::ScopedZone( char const *name ) noexcept:
+		mName    { name        },
+		mBeginNs { getTimeNs() }
+	{} // end-of-function: ScopedZone::ScopedZone
+	
+	
+	
+	ScopedZone::~ScopedZone() noexcept
+	{
+		record( mName, mBeginNs, getTimeNs() );
+	} // end-of-function: ScopedZone::~ScopedZone
+	
+	
+	
+	[[nodiscard]] u64
+	getTimeNs() noexcept
+	{
+		static auto const epoch { std::chrono::steady_clock::now() };
+		return static_cast<u64>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - epoch ).count()
+		);
+	} // end-of-function: getTimeNs
+	
+	
+	
+	void
+	setThreadName( std::string_view const name )
+	{
+		auto &ring     { getThreadRing() };
+		auto &registry { getRegistry()   };
+		std::scoped_lock lock { registry.mutex };
+		ring.name = name;
+	} // end-of-function: setThreadName
+	
+	
+	
+	void
+	writeChromeTrace( std::filesystem::path const &path )
+	{
+		std::ofstream file( path );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { "Failed to open the CPU trace output file!" };
+		
+		auto &registry { getRegistry() };
+		std::scoped_lock lock { registry.mutex };
+		
+		// NOTE: zone and thread names come from code (literals, `__func__`), so they're written unescaped
+		u64 zoneCount { 0 };
+		file << R"({"traceEvents":[)" "\n";
+		file << R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"CPU"}})";
+		for ( auto const &pRing: registry.rings ) {
+			auto const threadName {
+				pRing->name.empty() ? fmt::format( "thread #{}", pRing->threadId ) : pRing->name
+			};
+			file << fmt::format(
+				",\n" R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})",
+				pRing->threadId, threadName
+			);
+			for ( auto const &zone: takeSnapshot( *pRing ) ) {
+				file << fmt::format(
+					",\n" R"({{"name":"{}","cat":"cpu","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+					zone.name,
+					pRing->threadId,
+					static_cast<f64>( zone.beginNs              ) / 1'000.0,
+					static_cast<f64>( zone.endNs - zone.beginNs ) / 1'000.0
+				);
+			}
+			zoneCount += pRing->writeCount.load( std::memory_order_relaxed );
+		}
+		file << "\n]}\n";
+		spdlog::info( "Wrote the CPU trace of {} thread(s) to `{}` ({} zone(s) recorded in total)",
+		              registry.rings.size(), path.string(), zoneCount );
+	} // end-of-function: writeChromeTrace
+} // end-of-namespace: profiler
+// EOF
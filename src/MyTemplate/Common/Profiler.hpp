@@ -0,0 +1,65 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef PROFILER_HPP_K7N2QX4D
+#define PROFILER_HPP_K7N2QX4D
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <filesystem>
+#include <string_view>
+
+// NOTE: The zones compile out in release builds unless `PROFILER_FORCE_ENABLED` is defined
+//       (see the `PROFILER_FORCE_ENABLED` CMake option). The API below stays available either way.
+#if !defined( NDEBUG ) or defined( PROFILER_FORCE_ENABLED )
+#	define PROFILER_IS_ENABLED 1
+#endif
+
+#define PROFILER_CONCAT_IMPL( a, b ) a##b
+#define PROFILER_CONCAT( a, b )      PROFILER_CONCAT_IMPL( a, b )
+
+#if defined( PROFILER_IS_ENABLED )
+	// NOTE: `name` must have static storage duration (e.g. a string literal) since only the pointer is stored.
+#	define PROFILE_ZONE( name )        ::profiler::ScopedZone const PROFILER_CONCAT( profilerZone, __LINE__ ) { name }
+#	define PROFILE_FUNCTION()          PROFILE_ZONE( __func__ )
+#	define PROFILE_THREAD_NAME( name ) ::profiler::setThreadName( name )
+#else
+#	define PROFILE_ZONE( name )        static_cast<void>( 0 )
+#	define PROFILE_FUNCTION()          static_cast<void>( 0 )
+#	define PROFILE_THREAD_NAME( name ) static_cast<void>( 0 )
+#endif
+
+// Scoped-zone CPU profiler; every thread records into its own fixed-size ring buffer so that
+// recording a zone never takes a lock (the only lock is taken once per thread, on its first zone).
+// NOTE: When a ring wraps around, the oldest zones of that thread are overwritten.
+namespace profiler {
+	struct Zone final {
+		char const *name    { nullptr };
+		u64         beginNs { 0       }; // relative to the profiler's epoch
+		u64         endNs   { 0       };
+	}; // end-of-struct: Zone
+	
+	
+	
+	// Records the lifetime of the object as a zone on the calling thread.
+	class ScopedZone final {
+		public:
+			explicit ScopedZone( char const *name ) noexcept;
+			~ScopedZone() noexcept;
+			ScopedZone(             ScopedZone const &  ) = delete;
+			ScopedZone(             ScopedZone       && ) = delete;
+			ScopedZone & operator=( ScopedZone const &  ) = delete;
+			ScopedZone & operator=( ScopedZone       && ) = delete;
+		
+		private:
+			char const *mName;
+			u64         mBeginNs;
+	}; // end-of-class: ScopedZone
+	
+	
+	
+	[[nodiscard]] u64 getTimeNs() noexcept; // monotonic; relative to the profiler's epoch
+	void              setThreadName( std::string_view const ); // shows up as the thread's name in traces
+	void              writeChromeTrace( std::filesystem::path const & ); // snapshot of all threads' rings
+} // end-of-namespace: profiler
+
+#endif // end-of-header-guard PROFILER_HPP_K7N2QX4D
+// EOF
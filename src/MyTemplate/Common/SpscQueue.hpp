@@ -0,0 +1,79 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef SPSCQUEUE_HPP_K7NW2XPA
+#define SPSCQUEUE_HPP_K7NW2XPA
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <optional>
+#include <type_traits>
+
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+// NOTE: Neither side ever blocks or allocates; a push onto a full queue is rejected instead, so the
+//       producer can be e.g. a window system callback. The indices only ever increase (wrapping is
+//       handled by masking), and each one is written by one side only.
+template <typename T, u32 kCapacity>
+class SpscQueue final {
+	static_assert( std::has_single_bit( kCapacity ), "The capacity must be a power of two!" );
+	static_assert( std::is_nothrow_copy_assignable_v<T> and std::is_nothrow_default_constructible_v<T> );
+	
+	public:
+		SpscQueue() noexcept = default;
+		SpscQueue(             SpscQueue const &  ) = delete;
+		SpscQueue(             SpscQueue       && ) = delete;
+		SpscQueue & operator=( SpscQueue const &  ) = delete;
+		SpscQueue & operator=( SpscQueue       && ) = delete;
+		
+		[[nodiscard]] bool             tryPush( T const & ) noexcept; // producer only; false if full
+		[[nodiscard]] std::optional<T> tryPop()             noexcept; // consumer only; empty if empty
+		[[nodiscard]] bool             isEmpty()      const noexcept; // only exact on the consumer side
+	
+	private:
+		inline static u64 constexpr kCacheLineSize { 64 }; // keeps the two sides from false sharing
+		
+		alignas(kCacheLineSize) std::atomic<u64> mHead  { 0 }; // index of the next element to pop
+		alignas(kCacheLineSize) std::atomic<u64> mTail  { 0 }; // index of the next element to push
+		alignas(kCacheLineSize) std::array<T,kCapacity> mSlots {};
+}; // end-of-class: SpscQueue
+
+
+
+template <typename T, u32 kCapacity>
+[[nodiscard]] bool
+SpscQueue<T,kCapacity>::tryPush( T const &element ) noexcept
+{
+	auto const tail { mTail.load( std::memory_order_relaxed ) };
+	if ( tail - mHead.load( std::memory_order_acquire ) == kCapacity ) [[unlikely]]
+		return false;
+	mSlots[tail & (kCapacity - 1)] = element;
+	mTail.store( tail + 1, std::memory_order_release ); // publishes the element
+	return true;
+} // end-of-function: SpscQueue::tryPush
+
+
+
+template <typename T, u32 kCapacity>
+[[nodiscard]] std::optional<T>
+SpscQueue<T,kCapacity>::tryPop() noexcept
+{
+	auto const head { mHead.load( std::memory_order_relaxed ) };
+	if ( head == mTail.load( std::memory_order_acquire ) )
+		return std::nullopt;
+	std::optional<T> element { mSlots[head & (kCapacity - 1)] };
+	mHead.store( head + 1, std::memory_order_release ); // hands the slot back to the producer
+	return element;
+} // end-of-function: SpscQueue::tryPop
+
+
+
+template <typename T, u32 kCapacity>
+[[nodiscard]] bool
+SpscQueue<T,kCapacity>::isEmpty() const noexcept
+{
+	return mHead.load( std::memory_order_relaxed ) == mTail.load( std::memory_order_acquire );
+} // end-of-function: SpscQueue::isEmpty
+
+#endif // end-of-header-guard SPSCQUEUE_HPP_K7NW2XPA
+// EOF
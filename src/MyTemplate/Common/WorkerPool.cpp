@@ -0,0 +1,134 @@
+#include "MyTemplate/Common/WorkerPool.hpp"
+#include "MyTemplate/Common/Profiler.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <cassert>
+
+WorkerPool::WorkerPool( u32 const threadCount ):
+	mpTask       { nullptr },
+	mTaskCount   { 0       },
+	mNextTask    { 0       },
+	mBusyWorkers { 0       },
+	mGeneration  { 0       },
+	mShouldStop  { false   },
+	mpException  { nullptr }
+{
+	mThreads.reserve( threadCount );
+	for ( u32 i{0}; i < threadCount; ++i )
+		mThreads.emplace_back( &WorkerPool::runWorker, this, i + 1 ); // NOTE: index 0 is the calling thread
+} // end-of-function: WorkerPool::WorkerPool
+
+
+
+WorkerPool::~WorkerPool() noexcept
+{
+	{
+		std::scoped_lock lock { mMutex };
+		mShouldStop = true;
+	}
+	mWakeCondition.notify_all();
+	for ( auto &thread: mThreads )
+		thread.join();
+} // end-of-function: WorkerPool::~WorkerPool
+
+
+
+void
+WorkerPool::parallelFor( u32 const taskCount, Task const &task )
+{
+	if ( taskCount == 0 ) [[unlikely]]
+		return;
+	
+	// nothing to gain from waking the workers:
+	if ( mThreads.empty() or taskCount == 1 ) {
+		for ( u32 taskIndex{0}; taskIndex < taskCount; ++taskIndex )
+			task( taskIndex, 0 );
+		return;
+	}
+	
+	{
+		std::scoped_lock lock { mMutex };
+		// pre-condition(s):
+		assert( mpTask == nullptr and "parallelFor isn't re-entrant!" );
+		mpTask      = &task;
+		mTaskCount  =  taskCount;
+		mNextTask.store( 0, std::memory_order_relaxed );
+		mBusyWorkers = static_cast<u32>( mThreads.size() );
+		mpException  = nullptr;
+		++mGeneration;
+	}
+	mWakeCondition.notify_all();
+	
+	runTasks( 0 );
+	
+	std::unique_lock lock { mMutex };
+	mDoneCondition.wait( lock, [this] { return mBusyWorkers == 0; } );
+	mpTask = nullptr;
+	if ( mpException ) [[unlikely]]
+		std::rethrow_exception( std::exchange( mpException, nullptr ) );
+} // end-of-function: WorkerPool::parallelFor
+
+
+
+[[nodiscard]] u32
+WorkerPool::getWorkerCount() const noexcept
+{
+	return static_cast<u32>( mThreads.size() ) + 1;
+} // end-of-function: WorkerPool::getWorkerCount
+
+
+
+[[nodiscard]] u32
+WorkerPool::getDefaultThreadCount() noexcept
+{
+	// NOTE: `hardware_concurrency` may return 0 when it can't be determined
+	return std::max( std::thread::hardware_concurrency(), 1u ) - 1;
+} // end-of-function: WorkerPool::getDefaultThreadCount
+
+
+
+void
+WorkerPool::runWorker( u32 const workerIndex )
+{
+	PROFILE_THREAD_NAME( "worker #" + std::to_string( workerIndex ) );
+	u64 seenGeneration { 0 };
+	for (;;) {
+		{
+			std::unique_lock lock { mMutex };
+			mWakeCondition.wait( lock, [&] { return mShouldStop or mGeneration != seenGeneration; } );
+			if ( mShouldStop )
+				return;
+			seenGeneration = mGeneration;
+		}
+		runTasks( workerIndex );
+		{
+			std::scoped_lock lock { mMutex };
+			if ( --mBusyWorkers == 0 )
+				mDoneCondition.notify_one();
+		}
+	}
+} // end-of-function: WorkerPool::runWorker
+
+
+
+void
+WorkerPool::runTasks( u32 const workerIndex ) noexcept
+{
+	for (;;) {
+		auto const taskIndex { mNextTask.fetch_add( 1, std::memory_order_relaxed ) };
+		if ( taskIndex >= mTaskCount )
+			return;
+		try {
+			(*mpTask)( taskIndex, workerIndex );
+		}
+		catch ( ... ) {
+			std::scoped_lock lock { mMutex };
+			if ( not mpException )
+				mpException = std::current_exception();
+		}
+	}
+} // end-of-function: WorkerPool::runTasks
+
+// EOF
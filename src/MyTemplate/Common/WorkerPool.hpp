@@ -0,0 +1,55 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef WORKERPOOL_HPP_R3D8MWQZ
+#define WORKERPOOL_HPP_R3D8MWQZ
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <vector>
+
+// Fixed set of worker threads that execute index-based task ranges; the calling thread participates too.
+// NOTE: Each participant has a stable worker index in [0, getWorkerCount()) for the duration of a
+//       `parallelFor`, where 0 is always the calling thread. This lets callers keep per-worker state
+//       (e.g. command pools, which must not be used from several threads at once) without locking.
+class WorkerPool final {
+	public:
+		using Task = std::function<void( u32 taskIndex, u32 workerIndex )>;
+		
+		explicit WorkerPool( u32 const threadCount = getDefaultThreadCount() );
+		~WorkerPool() noexcept;
+		WorkerPool(             WorkerPool const &  ) = delete;
+		WorkerPool(             WorkerPool       && ) = delete;
+		WorkerPool & operator=( WorkerPool const &  ) = delete;
+		WorkerPool & operator=( WorkerPool       && ) = delete;
+		
+		// runs `task` for every index in [0, taskCount) and blocks until all have finished;
+		// the first exception thrown by a task is rethrown on the calling thread:
+		void parallelFor( u32 const taskCount, Task const & );
+		
+		[[nodiscard]] u32 getWorkerCount() const noexcept; // including the calling thread
+		[[nodiscard]] static u32 getDefaultThreadCount() noexcept; // one less than the hardware thread count
+	
+	private:
+		void runWorker( u32 const workerIndex );
+		void runTasks(  u32 const workerIndex ) noexcept;
+		
+		std::vector<std::thread> mThreads;
+		std::mutex               mMutex;
+		std::condition_variable  mWakeCondition;
+		std::condition_variable  mDoneCondition;
+		Task const              *mpTask;
+		u32                      mTaskCount;
+		std::atomic<u32>         mNextTask;
+		u32                      mBusyWorkers;
+		u64                      mGeneration;  // bumped once per `parallelFor` to wake the workers
+		bool                     mShouldStop;
+		std::exception_ptr       mpException;
+}; // end-of-class: WorkerPool
+
+#endif // end-of-header-guard WORKERPOOL_HPP_R3D8MWQZ
+// EOF
@@ -0,0 +1,366 @@
+#include "MyTemplate/Renderer/Allocator.hpp"
+#include "MyTemplate/Renderer/Suballocator.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/utility.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <cassert>
+
+namespace gfx {
+	struct Allocation::Block final {
+		vk::raii::DeviceMemory memory;
+		FreeListSuballocator   suballocator;
+		void                  *pMapped;     // persistently mapped if host visible; otherwise null
+		bool                   isDedicated; // dedicated blocks are released as soon as they're empty
+	}; // end-of-struct: Allocation::Block
+	
+	struct Allocator::Pool final {
+		u32                                             memoryTypeIndex;
+		ResourceKind                                    kind;
+		std::vector<std::unique_ptr<Allocation::Block>> blocks;
+	}; // end-of-struct: Allocator::Pool
+	
+	
+	
+	Allocation::Allocation(
+		Allocator      &allocator,
+		Block          &block,
+		u32            poolIndex,
+		vk::DeviceSize offset,
+		vk::DeviceSize size
+	) noexcept:
+		mpAllocator { &allocator },
+		mpBlock     { &block     },
+		mPoolIndex  {  poolIndex },
+		mOffset     {  offset    },
+		mSize       {  size      }
+	{} // end-of-function: Allocation::Allocation
+	
+	
+	
+	Allocation::Allocation( Allocation &&other ) noexcept:
+		mpAllocator { std::exchange( other.mpAllocator, nullptr ) },
+		mpBlock     { std::exchange( other.mpBlock,     nullptr ) },
+		mPoolIndex  { other.mPoolIndex                            },
+		mOffset     { other.mOffset                               },
+		mSize       { other.mSize                                 }
+	{} // end-of-function: Allocation::Allocation
+	
+	
+	
+	Allocation &
+	Allocation::operator=( Allocation &&other ) noexcept
+	{
+		if ( this != &other ) [[likely]] {
+			release();
+			mpAllocator = std::exchange( other.mpAllocator, nullptr );
+			mpBlock     = std::exchange( other.mpBlock,     nullptr );
+			mPoolIndex  = other.mPoolIndex;
+			mOffset     = other.mOffset;
+			mSize       = other.mSize;
+		}
+		return *this;
+	} // end-of-function: Allocation::operator=
+	
+	
+	
+	Allocation::~Allocation() noexcept
+	{
+		release();
+	} // end-of-function: Allocation::~Allocation
+	
+	
+	
+	void
+	Allocation::release() noexcept
+	{
+		if ( mpAllocator ) [[likely]] {
+			mpAllocator->free( *this );
+			mpAllocator = nullptr;
+			mpBlock     = nullptr;
+		}
+	} // end-of-function: Allocation::release
+	
+	
+	
+	[[nodiscard]] vk::DeviceMemory
+	Allocation::getMemory() const noexcept
+	{
+		assert( mpBlock != nullptr );
+		return *mpBlock->memory;
+	} // end-of-function: Allocation::getMemory
+	
+	
+	
+	[[nodiscard]] vk::DeviceSize
+	Allocation::getOffset() const noexcept
+	{
+		return mOffset;
+	} // end-of-function: Allocation::getOffset
+	
+	
+	
+	[[nodiscard]] vk::DeviceSize
+	Allocation::getSize() const noexcept
+	{
+		return mSize;
+	} // end-of-function: Allocation::getSize
+	
+	
+	
+	[[nodiscard]] void *
+	Allocation::getMappedData() const noexcept
+	{
+		if ( mpBlock == nullptr or mpBlock->pMapped == nullptr ) [[unlikely]]
+			return nullptr;
+		return static_cast<char *>( mpBlock->pMapped ) + mOffset;
+	} // end-of-function: Allocation::getMappedData
+	
+	
+	
+	[[nodiscard]] bool
+	Allocation::isValid() const noexcept
+	{
+		return mpAllocator != nullptr;
+	} // end-of-function: Allocation::isValid
+	
+	
+	
+	Allocator::Allocator(
+		vk::raii::PhysicalDevice const &physicalDevice,
+		vk::raii::Device         const &device,
+		vk::DeviceSize           const  blockSize
+	):
+		mpDevice              { &device                                                           },
+		mMemoryProperties     {  physicalDevice.getMemoryProperties()                             },
+		mMaxAllocationCount   {  physicalDevice.getProperties().limits.maxMemoryAllocationCount   },
+		mBlockSize            {  blockSize                                                        },
+		mDeviceAllocationCount{  0                                                                },
+		mPools                {                                                                   },
+		mMutex                {                                                                   }
+	{
+		spdlog::info( "Constructing an Allocator instance..." );
+		spdlog::info( "... block size: {} bytes", mBlockSize );
+		spdlog::info( "... device allocation limit: {}", mMaxAllocationCount );
+	} // end-of-function: Allocator::Allocator
+	
+	
+	
+	Allocator::~Allocator() noexcept
+	{
+		spdlog::info( "Destroying an Allocator instance..." );
+		// NOTE: all allocations should've been released by now; any remaining blocks are freed regardless
+		for ( auto const &pPool: mPools )
+			for ( auto const &pBlock: pPool->blocks )
+				if ( not pBlock->suballocator.isEmpty() ) [[unlikely]]
+					spdlog::warn( "... leaked {} allocation(s) in memory type #{}!", pBlock->suballocator.getAllocationCount(), pPool->memoryTypeIndex );
+	} // end-of-function: Allocator::~Allocator
+	
+	
+	
+	[[nodiscard]] u32
+	Allocator::findMemoryTypeIndex( u32 const typeFilter, vk::MemoryPropertyFlags const flags ) const
+	{
+		for ( u32 i{0};  i < mMemoryProperties.memoryTypeCount;  ++i ) 
+			if ( (typeFilter & (1 << i))
+			and  (mMemoryProperties.memoryTypes[i].propertyFlags & flags) == flags )
+				return i;
+		
+		throw std::runtime_error { "Unable to find an index of a suitable memory type!" };
+	} // end-of-function: Allocator::findMemoryTypeIndex
+	
+	
+	
+	[[nodiscard]] bool
+	Allocator::hasMemoryType( u32 const typeFilter, vk::MemoryPropertyFlags const flags ) const noexcept
+	{
+		for ( u32 i{0};  i < mMemoryProperties.memoryTypeCount;  ++i ) 
+			if ( (typeFilter & (1 << i))
+			and  (mMemoryProperties.memoryTypes[i].propertyFlags & flags) == flags )
+				return true;
+		
+		return false;
+	} // end-of-function: Allocator::hasMemoryType
+	
+	
+	
+	[[nodiscard]] u32
+	Allocator::getPoolIndex( u32 const memoryTypeIndex, ResourceKind const kind )
+	{
+		for ( u32 index{0};  index < mPools.size();  ++index )
+			if ( mPools[index]->memoryTypeIndex == memoryTypeIndex and mPools[index]->kind == kind )
+				return index;
+		
+		mPools.push_back( std::make_unique<Pool>( memoryTypeIndex, kind, std::vector<std::unique_ptr<Allocation::Block>>{} ) );
+		return static_cast<u32>( mPools.size() - 1 );
+	} // end-of-function: Allocator::getPoolIndex
+	
+	
+	
+	[[nodiscard]] std::unique_ptr<Allocation::Block>
+	Allocator::makeBlock( u32 const memoryTypeIndex, vk::DeviceSize const size, bool const isDedicated )
+	{
+		if ( mDeviceAllocationCount >= mMaxAllocationCount ) [[unlikely]]
+			throw std::runtime_error { "Exceeded the maximum number of device memory allocations!" };
+		
+		spdlog::info( "Allocating a {} byte device memory block from memory type #{}...", size, memoryTypeIndex );
+		auto memory {
+			vk::raii::DeviceMemory(
+				*mpDevice,
+				vk::MemoryAllocateInfo {
+					.allocationSize  = size,
+					.memoryTypeIndex = memoryTypeIndex
+				}
+			)
+		};
+		++mDeviceAllocationCount;
+		
+		bool const isHostVisible {
+			mMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible
+		};
+		// NOTE: host visible blocks are mapped once for their whole lifetime
+		void *pMapped { isHostVisible ? memory.mapMemory( 0, VK_WHOLE_SIZE ) : nullptr };
+		
+		return std::make_unique<Allocation::Block>(
+			std::move( memory ),
+			FreeListSuballocator( size ),
+			pMapped,
+			isDedicated
+		);
+	} // end-of-function: Allocator::makeBlock
+	
+	
+	
+	[[nodiscard]] Allocation
+	Allocator::allocate(
+		vk::MemoryRequirements  const &requirements,
+		vk::MemoryPropertyFlags const  properties,
+		ResourceKind            const  kind
+	)
+	{
+		std::scoped_lock lock { mMutex };
+		
+		auto const memoryTypeIndex { findMemoryTypeIndex( requirements.memoryTypeBits, properties ) };
+		auto const poolIndex       { getPoolIndex( memoryTypeIndex, kind ) };
+		auto      &pool            { *mPools[poolIndex] };
+		
+		// large resources get a dedicated block of their own:
+		if ( requirements.size > mBlockSize / 2 ) [[unlikely]] {
+			pool.blocks.push_back( makeBlock( memoryTypeIndex, requirements.size, true ) );
+			auto &block { *pool.blocks.back() };
+			auto const offset { block.suballocator.allocate( requirements.size, requirements.alignment ) };
+			assert( offset.has_value() );
+			return Allocation( *this, block, poolIndex, *offset, requirements.size );
+		}
+		
+		for ( auto &pBlock: pool.blocks ) {
+			if ( pBlock->isDedicated )
+				continue;
+			if ( auto const offset{ pBlock->suballocator.allocate( requirements.size, requirements.alignment ) } ) [[likely]]
+				return Allocation( *this, *pBlock, poolIndex, *offset, requirements.size );
+		}
+		
+		// no existing block had room; grow the pool:
+		pool.blocks.push_back( makeBlock( memoryTypeIndex, mBlockSize, false ) );
+		auto &block { *pool.blocks.back() };
+		auto const offset { block.suballocator.allocate( requirements.size, requirements.alignment ) };
+		assert( offset.has_value() );
+		return Allocation( *this, block, poolIndex, *offset, requirements.size );
+	} // end-of-function: Allocator::allocate
+	
+	
+	
+	[[nodiscard]] Allocation
+	Allocator::allocate( vk::raii::Buffer const &buffer, vk::MemoryPropertyFlags const properties )
+	{
+		auto allocation { allocate( buffer.getMemoryRequirements(), properties, ResourceKind::eLinear ) };
+		buffer.bindMemory( allocation.getMemory(), allocation.getOffset() );
+		return allocation;
+	} // end-of-function: Allocator::allocate
+	
+	
+	
+	[[nodiscard]] Allocation
+	Allocator::allocate( vk::raii::Image const &image, vk::MemoryPropertyFlags const properties )
+	{
+		auto allocation { allocate( image.getMemoryRequirements(), properties, ResourceKind::eOptimal ) };
+		image.bindMemory( allocation.getMemory(), allocation.getOffset() );
+		return allocation;
+	} // end-of-function: Allocator::allocate
+	
+	
+	
+	void
+	Allocator::free( Allocation &allocation ) noexcept
+	{
+		std::scoped_lock lock { mMutex };
+		
+		assert( allocation.mPoolIndex < mPools.size() );
+		auto &pool  { *mPools[allocation.mPoolIndex] };
+		auto &block { *allocation.mpBlock            };
+		block.suballocator.free( allocation.mOffset );
+		
+		// release empty dedicated blocks, and empty regular blocks as long as another regular block remains:
+		if ( block.suballocator.isEmpty() ) {
+			auto const regularBlockCount {
+				std::ranges::count_if( pool.blocks, []( auto const &pBlock ) { return not pBlock->isDedicated; } )
+			};
+			if ( block.isDedicated or regularBlockCount > 1 ) {
+				std::erase_if( pool.blocks, [&block]( auto const &pBlock ) { return pBlock.get() == &block; } );
+				--mDeviceAllocationCount;
+			}
+		}
+	} // end-of-function: Allocator::free
+	
+	
+	
+	[[nodiscard]] std::vector<Allocator::HeapStats>
+	Allocator::getHeapStats() const
+	{
+		std::scoped_lock lock { mMutex };
+		
+		std::vector<HeapStats> stats( mMemoryProperties.memoryHeapCount );
+		for ( u32 heapIndex{0};  heapIndex < mMemoryProperties.memoryHeapCount;  ++heapIndex )
+			stats[heapIndex].heapSize = mMemoryProperties.memoryHeaps[heapIndex].size;
+		
+		for ( auto const &pPool: mPools ) {
+			auto &heapStats { stats[ mMemoryProperties.memoryTypes[pPool->memoryTypeIndex].heapIndex ] };
+			for ( auto const &pBlock: pPool->blocks ) {
+				auto const &suballocator { pBlock->suballocator };
+				heapStats.reservedSize    += suballocator.getCapacity();
+				heapStats.usedSize        += suballocator.getUsedSize();
+				heapStats.blockCount      += 1;
+				heapStats.allocationCount += static_cast<u32>( suballocator.getAllocationCount() );
+				heapStats.fragmentation    = std::max( heapStats.fragmentation, suballocator.getFragmentation() );
+			}
+		}
+		return stats;
+	} // end-of-function: Allocator::getHeapStats
+	
+	
+	
+	void
+	Allocator::logStats() const
+	{
+		spdlog::info( "Device memory usage:" );
+		auto const stats { getHeapStats() };
+		for ( u32 heapIndex{0};  heapIndex < stats.size();  ++heapIndex ) {
+			auto const &heap { stats[heapIndex] };
+			if ( heap.blockCount == 0 )
+				continue;
+			spdlog::info(
+				"... heap #{}: {}/{} bytes used of {} reserved ({} block(s), {} allocation(s), {:.1f}% fragmentation)",
+				heapIndex, heap.usedSize, heap.heapSize, heap.reservedSize,
+				heap.blockCount, heap.allocationCount, heap.fragmentation * 100.0f
+			);
+		}
+	} // end-of-function: Allocator::logStats
+} // end-of-namespace: gfx
+// EOF
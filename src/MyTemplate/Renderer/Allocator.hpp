@@ -0,0 +1,105 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef ALLOCATOR_HPP_M2RB7XQE
+#define ALLOCATOR_HPP_M2RB7XQE
+
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Renderer/Suballocator.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <memory>
+#include <vector>
+#include <mutex>
+
+namespace gfx {
+	class Allocator;
+	
+	// NOTE: Linear (buffers, linearly tiled images) and optimal (optimally tiled images) resources
+	//       are kept in separate pools so that `bufferImageGranularity` never has to be considered.
+	enum struct ResourceKind {
+		eLinear ,
+		eOptimal,
+	}; // end-of-enum-struct: ResourceKind
+	
+	
+	
+	// Move-only handle to a sub-allocated range of device memory; releases the range on destruction.
+	class Allocation final {
+		public:
+			Allocation() noexcept = default;
+			Allocation(             Allocation const &  )          = delete;
+			Allocation(             Allocation       && ) noexcept;
+			Allocation & operator=( Allocation const &  )          = delete;
+			Allocation & operator=( Allocation       && ) noexcept;
+			~Allocation() noexcept;
+			
+			[[nodiscard]] vk::DeviceMemory getMemory()     const noexcept;
+			[[nodiscard]] vk::DeviceSize   getOffset()     const noexcept;
+			[[nodiscard]] vk::DeviceSize   getSize()       const noexcept;
+			[[nodiscard]] void           * getMappedData() const noexcept; // null unless host visible
+			[[nodiscard]] bool             isValid()       const noexcept;
+		
+		private:
+			friend class Allocator;
+			struct Block;
+			Allocation( Allocator &, Block &, u32 poolIndex, vk::DeviceSize offset, vk::DeviceSize size ) noexcept;
+			void release() noexcept;
+			
+			Allocator      *mpAllocator { nullptr };
+			Block          *mpBlock     { nullptr };
+			u32             mPoolIndex  { 0       };
+			vk::DeviceSize  mOffset     { 0       };
+			vk::DeviceSize  mSize       { 0       };
+	}; // end-of-class: Allocation
+	
+	
+	
+	// Block-based device memory allocator with one pool per (memory type, resource kind) pair.
+	class Allocator final {
+		public:
+			struct HeapStats final {
+				vk::DeviceSize heapSize        { 0 };
+				vk::DeviceSize reservedSize    { 0 }; // allocated from Vulkan
+				vk::DeviceSize usedSize        { 0 }; // handed out to resources
+				u32            blockCount      { 0 };
+				u32            allocationCount { 0 };
+				f32            fragmentation   { 0 }; // worst block fragmentation within the heap
+			}; // end-of-struct: Allocator::HeapStats
+			
+			inline static vk::DeviceSize constexpr kDefaultBlockSize { 64ull * 1024 * 1024 }; // 64 MiB
+			
+			Allocator( vk::raii::PhysicalDevice const &, vk::raii::Device const &, vk::DeviceSize const blockSize = kDefaultBlockSize );
+			~Allocator() noexcept;
+			Allocator(             Allocator const &  ) = delete;
+			Allocator(             Allocator       && ) = delete;
+			Allocator & operator=( Allocator const &  ) = delete;
+			Allocator & operator=( Allocator       && ) = delete;
+			
+			[[nodiscard]] Allocation             allocate( vk::MemoryRequirements const &, vk::MemoryPropertyFlags const, ResourceKind const );
+			[[nodiscard]] Allocation             allocate( vk::raii::Buffer       const &, vk::MemoryPropertyFlags const ); // also binds
+			[[nodiscard]] Allocation             allocate( vk::raii::Image        const &, vk::MemoryPropertyFlags const ); // also binds
+			[[nodiscard]] u32                    findMemoryTypeIndex( u32 const typeFilter, vk::MemoryPropertyFlags const ) const;
+			[[nodiscard]] bool                   hasMemoryType(       u32 const typeFilter, vk::MemoryPropertyFlags const ) const noexcept;
+			[[nodiscard]] std::vector<HeapStats> getHeapStats() const;
+			void                                 logStats() const;
+		
+		private:
+			friend class Allocation;
+			struct Pool;
+			[[nodiscard]] u32 getPoolIndex( u32 const memoryTypeIndex, ResourceKind const );
+			[[nodiscard]] std::unique_ptr<Allocation::Block> makeBlock( u32 const memoryTypeIndex, vk::DeviceSize const size, bool const isDedicated );
+			void free( Allocation & ) noexcept;
+			
+			vk::raii::Device const             *mpDevice;
+			vk::PhysicalDeviceMemoryProperties  mMemoryProperties;
+			u32                                 mMaxAllocationCount;
+			vk::DeviceSize                      mBlockSize;
+			u32                                 mDeviceAllocationCount;
+			std::vector<std::unique_ptr<Pool>>  mPools;
+			mutable std::mutex                  mMutex;
+	}; // end-of-class: Allocator
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard ALLOCATOR_HPP_M2RB7XQE
+// EOF
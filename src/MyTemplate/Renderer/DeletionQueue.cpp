@@ -0,0 +1,86 @@
+#include "MyTemplate/Renderer/DeletionQueue.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace gfx {
+	DeletionQueue::~DeletionQueue() noexcept
+	{
+		flush();
+	} // end-of-function: DeletionQueue::~DeletionQueue
+	
+	
+	
+	void
+	DeletionQueue::push( std::unique_ptr<Holder> pHolder, u64 frameCount, u64 const currentFrame )
+	{
+		// NOTE: keeps the entries sorted so that `collect` only has to look at the front;
+		//       bumping an out-of-order frame count only ever delays the destruction.
+		if ( not mEntries.empty() )
+			frameCount = std::max( frameCount, mEntries.back().frameCount );
+		mEntries.push_back(
+			Entry {
+				.frameCount     = frameCount,
+				.retiredOnFrame = currentFrame,
+				.pHolder        = std::move( pHolder )
+			}
+		);
+		mStats.retiredCount         += 1;
+		mStats.pendingCount          = mEntries.size();
+		mStats.pendingHighWaterMark  = std::max( mStats.pendingHighWaterMark, mStats.pendingCount );
+	} // end-of-function: DeletionQueue::push
+	
+	
+	
+	void
+	DeletionQueue::collect( u64 const completedFrameCount, u64 const currentFrame )
+	{
+		while ( not mEntries.empty() and mEntries.front().frameCount <= completedFrameCount ) {
+			auto const latency { currentFrame - std::min( currentFrame, mEntries.front().retiredOnFrame ) };
+			mStats.destroyedCount += 1;
+			mStats.totalLatency   += latency;
+			mStats.maxLatency      = std::max( mStats.maxLatency, latency );
+			mEntries.pop_front(); // NOTE: destroys the resource
+		}
+		mStats.pendingCount = mEntries.size();
+	} // end-of-function: DeletionQueue::collect
+	
+	
+	
+	void
+	DeletionQueue::flush() noexcept
+	{
+		// NOTE: destroyed in retirement order, just like `collect` would
+		while ( not mEntries.empty() ) {
+			mEntries.pop_front();
+			mStats.destroyedCount += 1;
+		}
+		mStats.pendingCount = 0;
+	} // end-of-function: DeletionQueue::flush
+	
+	
+	
+	[[nodiscard]] bool
+	DeletionQueue::isEmpty() const noexcept
+	{
+		return mEntries.empty();
+	} // end-of-function: DeletionQueue::isEmpty
+	
+	
+	
+	[[nodiscard]] u64
+	DeletionQueue::getSize() const noexcept
+	{
+		return mEntries.size();
+	} // end-of-function: DeletionQueue::getSize
+	
+	
+	
+	[[nodiscard]] DeletionQueue::Stats
+	DeletionQueue::getStats() const noexcept
+	{
+		return mStats;
+	} // end-of-function: DeletionQueue::getStats
+} // end-of-namespace: gfx
+// EOF
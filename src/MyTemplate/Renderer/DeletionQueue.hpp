@@ -0,0 +1,79 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef DELETIONQUEUE_HPP_P4LT8ZNE
+#define DELETIONQUEUE_HPP_P4LT8ZNE
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <deque>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace gfx {
+	// Defers the destruction of GPU resources (buffers, images, views, pipelines, ...) until every frame
+	// that could have used them has completed, so they can be released at runtime without a device-wide stall.
+	// NOTE: Resources are keyed by a frame count: the resource is destroyed once the first `frameCount` frames
+	//       have completed (i.e. pass the index of the last frame that used it plus one).
+	class DeletionQueue final {
+		public:
+			struct Stats final {
+				u64 pendingCount         { 0 };
+				u64 pendingHighWaterMark { 0 };
+				u64 retiredCount         { 0 }; // in total
+				u64 destroyedCount       { 0 }; // in total
+				u64 totalLatency         { 0 }; // in frames, summed over all destroyed resources
+				u64 maxLatency           { 0 }; // in frames
+			}; // end-of-struct: DeletionQueue::Stats
+			
+			DeletionQueue() noexcept = default;
+			~DeletionQueue() noexcept;
+			DeletionQueue(             DeletionQueue const &  ) = delete;
+			DeletionQueue(             DeletionQueue       && ) = delete;
+			DeletionQueue & operator=( DeletionQueue const &  ) = delete;
+			DeletionQueue & operator=( DeletionQueue       && ) = delete;
+			
+			template <typename T> requires std::is_nothrow_destructible_v<T>
+			void retire( T &&resource, u64 const frameCount, u64 const currentFrame );
+			
+			void                collect( u64 const completedFrameCount, u64 const currentFrame ); // destroys what is no longer in use
+			void                flush() noexcept; // destroys everything; only call once the device is idle
+			[[nodiscard]] bool  isEmpty()  const noexcept;
+			[[nodiscard]] u64   getSize()  const noexcept;
+			[[nodiscard]] Stats getStats() const noexcept;
+		
+		private:
+			struct Holder {
+				virtual ~Holder() noexcept = default;
+			}; // end-of-struct: DeletionQueue::Holder
+			
+			template <typename T>
+			struct HolderOf final: Holder {
+				explicit HolderOf( T &&resource ): resource { std::move( resource ) } {}
+				T resource;
+			}; // end-of-struct: DeletionQueue::HolderOf
+			
+			struct Entry final {
+				u64                     frameCount;   // destroy once this many frames have completed
+				u64                     retiredOnFrame;
+				std::unique_ptr<Holder> pHolder;
+			}; // end-of-struct: DeletionQueue::Entry
+			
+			void push( std::unique_ptr<Holder>, u64 frameCount, u64 const currentFrame );
+			
+			std::deque<Entry> mEntries; // sorted by frame count (oldest first)
+			Stats             mStats;
+	}; // end-of-class: DeletionQueue
+	
+	
+	
+	template <typename T> requires std::is_nothrow_destructible_v<T>
+	void
+	DeletionQueue::retire( T &&resource, u64 const frameCount, u64 const currentFrame )
+	{
+		static_assert( not std::is_lvalue_reference_v<T>, "Resources have to be moved into the deletion queue!" );
+		push( std::make_unique<HolderOf<T>>( std::move( resource ) ), frameCount, currentFrame );
+	} // end-of-function: DeletionQueue::retire
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard DELETIONQUEUE_HPP_P4LT8ZNE
+// EOF
@@ -0,0 +1,48 @@
+#include "MyTemplate/Renderer/DrawList.hpp"
+
+#include <cassert>
+
+namespace gfx {
+	void
+	DrawList::enqueue( DrawCommand const &command )
+	{
+		// pre-condition(s):
+		assert( command.vertexBuffer );
+		assert( command.indexBuffer  );
+		
+		mCommands.push_back( command );
+	} // end-of-function: DrawList::enqueue
+	
+	
+	
+	void
+	DrawList::clear() noexcept
+	{
+		mCommands.clear();
+	} // end-of-function: DrawList::clear
+	
+	
+	
+	[[nodiscard]] std::span<DrawCommand const>
+	DrawList::getCommands() const noexcept
+	{
+		return mCommands;
+	} // end-of-function: DrawList::getCommands
+	
+	
+	
+	[[nodiscard]] u64
+	DrawList::getSize() const noexcept
+	{
+		return mCommands.size();
+	} // end-of-function: DrawList::getSize
+	
+	
+	
+	[[nodiscard]] bool
+	DrawList::isEmpty() const noexcept
+	{
+		return mCommands.empty();
+	} // end-of-function: DrawList::isEmpty
+} // end-of-namespace: gfx
+// EOF
@@ -0,0 +1,48 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef DRAWLIST_HPP_K7NQ2VXM
+#define DRAWLIST_HPP_K7NQ2VXM
+
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Renderer/Uniforms.hpp"
+
+#include <vulkan/vulkan.hpp>
+
+#include <span>
+#include <vector>
+
+namespace gfx {
+	// Everything needed to record one indexed draw; the referenced buffers (and texture) must stay alive until the frame completes.
+	struct DrawCommand final {
+		vk::Buffer        vertexBuffer       {                        };
+		vk::DeviceSize    vertexBufferOffset { 0                      };
+		vk::Buffer        indexBuffer        {                        };
+		vk::DeviceSize    indexBufferOffset  { 0                      };
+		vk::IndexType     indexType          { vk::IndexType::eUint16 };
+		u32               indexCount         { 0                      };
+		u32               instanceCount      { 1                      };
+		u32               firstIndex         { 0                      };
+		i32               vertexOffset       { 0                      };
+		u32               firstInstance      { 0                      };
+		vk::DescriptorSet textureSet         {                        }; // see: Texture::getDescriptorSet (null for the renderer's default texture)
+		ObjectUniforms    object             {                        }; // copied into the frame's uniform data when recorded
+	}; // end-of-struct: DrawCommand
+	
+	
+	
+	// Draws enqueued by game/UI code during a frame; consumed (and cleared) by the renderer when recording.
+	class DrawList final {
+		public:
+			void enqueue( DrawCommand const & );
+			void clear() noexcept; // NOTE: keeps the capacity so steady-state frames don't allocate
+			
+			[[nodiscard]] std::span<DrawCommand const> getCommands() const noexcept;
+			[[nodiscard]] u64                          getSize()     const noexcept;
+			[[nodiscard]] bool                         isEmpty()     const noexcept;
+		
+		private:
+			std::vector<DrawCommand> mCommands;
+	}; // end-of-class: DrawList
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard DRAWLIST_HPP_K7NQ2VXM
+// EOF
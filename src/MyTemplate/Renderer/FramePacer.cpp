@@ -0,0 +1,128 @@
+#include "MyTemplate/Renderer/FramePacer.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		f64 constexpr kSmoothing       { 0.1  }; // weight of the newest sample in the moving averages
+		f64 constexpr kSafetyMarginMs  { 0.5  }; // subtracted from the predicted slack to absorb jitter
+		f64 constexpr kSpinThresholdMs { 1.0  }; // the tail of a sleep is spun since OS sleeps tend to overshoot
+		
+		[[nodiscard]] f64
+		blend( f64 const average, f64 const sample ) noexcept
+		{
+			return average == 0 ? sample : average + kSmoothing * (sample - average);
+		} // end-of-function: blend
+		
+		[[nodiscard]] f64
+		getElapsedMs( FramePacer::Clock::time_point const from, FramePacer::Clock::time_point const to ) noexcept
+		{
+			return std::chrono::duration<f64,std::milli>( to - from ).count();
+		} // end-of-function: getElapsedMs
+		
+		[[nodiscard]] FramePacer::Clock::duration
+		toDuration( f64 const ms ) noexcept
+		{
+			return std::chrono::duration_cast<FramePacer::Clock::duration>( std::chrono::duration<f64,std::milli>( ms ) );
+		} // end-of-function: toDuration
+	} // end-of-unnamed-namespace
+	
+	
+	
+	FramePacer::FramePacer() noexcept:
+		mWorkStart      {       },
+		mLastPresent    {       },
+		mHasWorkStart   { false },
+		mHasLastPresent { false },
+		mFramePeriodMs  { 0     },
+		mCpuWorkMs      { 0     },
+		mGpuWorkMs      { 0     },
+		mLastSleepMs    { 0     }
+	{} // end-of-function: FramePacer::FramePacer
+	
+	
+	
+	void
+	FramePacer::waitForDeadline( f64 const gpuFrameMs )
+	{
+		if ( gpuFrameMs > 0 ) [[likely]]
+			mGpuWorkMs = blend( mGpuWorkMs, gpuFrameMs );
+		
+		mLastSleepMs = 0;
+		if ( mHasLastPresent and mFramePeriodMs > 0 and mCpuWorkMs > 0 ) [[likely]] {
+			// the next present is due one period after the last one, and the frame's work has to be done by then:
+			auto const deadline {
+				mLastPresent + toDuration( mFramePeriodMs - getPredictedWorkMs() - kSafetyMarginMs )
+			};
+			auto const sleepStart { Clock::now() };
+			if ( sleepStart < deadline ) {
+				auto const spinStart { deadline - toDuration( kSpinThresholdMs ) };
+				if ( sleepStart < spinStart )
+					std::this_thread::sleep_until( spinStart );
+				while ( Clock::now() < deadline )
+					std::this_thread::yield();
+				mLastSleepMs = getElapsedMs( sleepStart, Clock::now() );
+			}
+		}
+		mWorkStart    = Clock::now();
+		mHasWorkStart = true;
+	} // end-of-function: FramePacer::waitForDeadline
+	
+	
+	
+	void
+	FramePacer::markSubmitted() noexcept
+	{
+		if ( not mHasWorkStart ) [[unlikely]]
+			return;
+		mCpuWorkMs    = blend( mCpuWorkMs, getElapsedMs( mWorkStart, Clock::now() ) );
+		mHasWorkStart = false;
+	} // end-of-function: FramePacer::markSubmitted
+	
+	
+	
+	void
+	FramePacer::markPresented() noexcept
+	{
+		auto const now { Clock::now() };
+		if ( mHasLastPresent ) [[likely]]
+			mFramePeriodMs = blend( mFramePeriodMs, getElapsedMs( mLastPresent, now ) );
+		mLastPresent    = now;
+		mHasLastPresent = true;
+	} // end-of-function: FramePacer::markPresented
+	
+	
+	
+	void
+	FramePacer::reset() noexcept
+	{
+		*this = FramePacer {};
+	} // end-of-function: FramePacer::reset
+	
+	
+	
+	[[nodiscard]] f64
+	FramePacer::getFramePeriodMs() const noexcept
+	{
+		return mFramePeriodMs;
+	} // end-of-function: FramePacer::getFramePeriodMs
+	
+	
+	
+	[[nodiscard]] f64
+	FramePacer::getPredictedWorkMs() const noexcept
+	{
+		return mCpuWorkMs + mGpuWorkMs;
+	} // end-of-function: FramePacer::getPredictedWorkMs
+	
+	
+	
+	[[nodiscard]] f64
+	FramePacer::getLastSleepMs() const noexcept
+	{
+		return mLastSleepMs;
+	} // end-of-function: FramePacer::getLastSleepMs
+} // end-of-namespace: gfx
+// EOF
@@ -0,0 +1,48 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef FRAMEPACER_HPP_Q4MZ8XRD
+#define FRAMEPACER_HPP_Q4MZ8XRD
+
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <chrono>
+
+namespace gfx {
+	// Delays the start of a frame's CPU work (i.e. input sampling, recording) for as long as it can
+	// while still presenting on time, so the input a frame is built from is as fresh as possible.
+	// NOTE: The deadline is predicted from moving averages of the present-to-present period, the CPU
+	//       time from the start of work until submission, and the measured GPU time of the frame.
+	//       Sleeping makes the following period shrink by at most the safety margin, so when nothing
+	//       (e.g. vsync) throttles presentation the sleep converges to zero instead of capping the rate.
+	class FramePacer final {
+		public:
+			using Clock = std::chrono::steady_clock;
+			
+			FramePacer() noexcept;
+			
+			// sleeps until the predicted deadline (if any) and marks the start of the frame's work:
+			void waitForDeadline( f64 const gpuFrameMs );
+			// marks the end of the frame's CPU work (i.e. once submitted; blocking in present isn't work):
+			void markSubmitted() noexcept;
+			// marks the frame as presented (the present call returned):
+			void markPresented() noexcept;
+			// forgets all measurements (e.g. once the swapchain or present mode has changed):
+			void reset() noexcept;
+			
+			[[nodiscard]] f64 getFramePeriodMs()  const noexcept; // 0 until measured
+			[[nodiscard]] f64 getPredictedWorkMs() const noexcept; // CPU + GPU; 0 until measured
+			[[nodiscard]] f64 getLastSleepMs()    const noexcept;
+		
+		private:
+			Clock::time_point mWorkStart;
+			Clock::time_point mLastPresent;
+			bool              mHasWorkStart;
+			bool              mHasLastPresent;
+			f64               mFramePeriodMs; // moving average
+			f64               mCpuWorkMs;     // moving average
+			f64               mGpuWorkMs;     // moving average
+			f64               mLastSleepMs;
+	}; // end-of-class: FramePacer
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard FRAMEPACER_HPP_Q4MZ8XRD
+// EOF
@@ -0,0 +1,183 @@
+#include "MyTemplate/Renderer/FrameTimeline.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		u32 constexpr kMaxSignalSemaphores { 4 }; // including the timeline semaphore
+	} // end-of-unnamed-namespace
+	
+	
+	
+	FrameTimeline::FrameTimeline(
+		vk::raii::Device const &device,
+		bool             const  useTimelineSemaphore,
+		u32              const  frameSlotCount
+	):
+		mpDevice             { &device },
+		mpSemaphore          { nullptr },
+		mCompletedFrameCount { 0       },
+		mSubmittedFrameCount { 0       }
+	{
+		// pre-condition(s):
+		assert( frameSlotCount > 0 );
+		
+		if ( useTimelineSemaphore ) [[likely]] {
+			spdlog::info( "... using a timeline semaphore for frame pacing" );
+			vk::SemaphoreTypeCreateInfo const typeCreateInfo {
+				.semaphoreType = vk::SemaphoreType::eTimeline,
+				.initialValue  = 0
+			};
+			mpSemaphore = std::make_unique<vk::raii::Semaphore>(
+				device,
+				vk::SemaphoreCreateInfo { .pNext = &typeCreateInfo }
+			);
+		}
+		else {
+			spdlog::info( "... using {} fence(s) for frame pacing (timeline semaphores unavailable)", frameSlotCount );
+			mFences.reserve( frameSlotCount );
+			for ( u32 i{0}; i < frameSlotCount; ++i )
+				mFences.emplace_back( device.createFence({}) );
+			mSlotFrames.assign( frameSlotCount, max<u64> ); // nothing submitted yet
+		}
+	} // end-of-function: FrameTimeline::FrameTimeline
+	
+	
+	
+	void
+	FrameTimeline::submit( vk::raii::Queue const &queue, vk::SubmitInfo const &submitInfo, u64 const frame )
+	{
+		// pre-condition(s):
+		//   frames are submitted exactly once and in order:
+		assert( frame == mSubmittedFrameCount );
+		
+		if ( mpSemaphore ) [[likely]] {
+			assert( submitInfo.signalSemaphoreCount < kMaxSignalSemaphores );
+			assert( submitInfo.pNext == nullptr );
+			// NOTE: values are ignored for binary semaphores but the counts have to match
+			std::array<vk::Semaphore,kMaxSignalSemaphores> signalSemaphores {};
+			std::array<u64,kMaxSignalSemaphores>           signalValues     {};
+			std::copy_n( submitInfo.pSignalSemaphores, submitInfo.signalSemaphoreCount, signalSemaphores.begin() );
+			signalSemaphores[submitInfo.signalSemaphoreCount] = **mpSemaphore;
+			signalValues    [submitInfo.signalSemaphoreCount] = frame + 1;
+			vk::TimelineSemaphoreSubmitInfo const timelineInfo {
+				.signalSemaphoreValueCount = submitInfo.signalSemaphoreCount + 1,
+				.pSignalSemaphoreValues    = signalValues.data()
+			};
+			auto augmentedInfo { submitInfo };
+			augmentedInfo.pNext                = &timelineInfo;
+			augmentedInfo.signalSemaphoreCount = submitInfo.signalSemaphoreCount + 1;
+			augmentedInfo.pSignalSemaphores    = signalSemaphores.data();
+			queue.submit( augmentedInfo );
+		}
+		else {
+			auto const slot { frame % mFences.size() };
+			// NOTE: the slot's previous frame must have been waited for before its fence can be reused
+			assert( mSlotFrames[slot] == max<u64> or mSlotFrames[slot] < mCompletedFrameCount );
+			mpDevice->resetFences( *mFences[slot] );
+			queue.submit( submitInfo, *mFences[slot] );
+			mSlotFrames[slot] = frame;
+		}
+		mSubmittedFrameCount = frame + 1;
+	} // end-of-function: FrameTimeline::submit
+	
+	
+	
+	[[nodiscard]] bool
+	FrameTimeline::waitFor( u64 const frameCount, u64 const timeout )
+	{
+		// pre-condition(s):
+		//   waiting on frames that haven't been submitted would never return:
+		assert( frameCount <= mSubmittedFrameCount );
+		
+		if ( frameCount <= mCompletedFrameCount )
+			return true;
+		
+		vk::Result waitResult;
+		if ( mpSemaphore ) [[likely]] {
+			waitResult = mpDevice->waitSemaphores(
+				vk::SemaphoreWaitInfo {
+					.semaphoreCount = 1,
+					.pSemaphores    = &**mpSemaphore,
+					.pValues        = &frameCount
+				},
+				timeout
+			);
+		}
+		else {
+			// NOTE: Submissions to the queue complete in order, so waiting for the fence of the slot that
+			//       the frame was submitted with is enough (it may belong to a later frame; which is conservative).
+			auto const slot { (frameCount - 1) % mFences.size() };
+			waitResult = mpDevice->waitForFences( *mFences[slot], VK_TRUE, timeout );
+		}
+		// NOTE: any other result (e.g. a lost device) is thrown by Vulkan-Hpp as a `vk::SystemError`
+		if ( waitResult == vk::Result::eTimeout ) [[unlikely]]
+			return false;
+		assert( waitResult == vk::Result::eSuccess );
+		
+		mCompletedFrameCount = std::max( mCompletedFrameCount, frameCount );
+		return true;
+	} // end-of-function: FrameTimeline::waitFor
+	
+	
+	
+	[[nodiscard]] bool
+	FrameTimeline::hasCompleted( u64 const frameCount )
+	{
+		if ( frameCount <= mCompletedFrameCount )
+			return true;
+		return getCompletedFrameCount() >= frameCount;
+	} // end-of-function: FrameTimeline::hasCompleted
+	
+	
+	
+	[[nodiscard]] u64
+	FrameTimeline::getCompletedFrameCount()
+	{
+		if ( mpSemaphore ) [[likely]]
+			mCompletedFrameCount = std::max( mCompletedFrameCount, mpSemaphore->getCounterValue() );
+		else
+			updateFromFences();
+		return mCompletedFrameCount;
+	} // end-of-function: FrameTimeline::getCompletedFrameCount
+	
+	
+	
+	[[nodiscard]] u64
+	FrameTimeline::getSubmittedFrameCount() const noexcept
+	{
+		return mSubmittedFrameCount;
+	} // end-of-function: FrameTimeline::getSubmittedFrameCount
+	
+	
+	
+	[[nodiscard]] bool
+	FrameTimeline::isUsingTimelineSemaphore() const noexcept
+	{
+		return mpSemaphore != nullptr;
+	} // end-of-function: FrameTimeline::isUsingTimelineSemaphore
+	
+	
+	
+	void
+	FrameTimeline::updateFromFences()
+	{
+		for ( u32 slot{0}; slot < mFences.size(); ++slot ) {
+			auto const frame { mSlotFrames[slot] };
+			if ( frame == max<u64> or frame < mCompletedFrameCount )
+				continue; // nothing new to learn from this slot
+			if ( mFences[slot].getStatus() == vk::Result::eSuccess )
+				mCompletedFrameCount = std::max( mCompletedFrameCount, frame + 1 );
+		}
+	} // end-of-function: FrameTimeline::updateFromFences
+} // end-of-namespace: gfx
+// EOF
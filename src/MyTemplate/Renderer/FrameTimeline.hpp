@@ -0,0 +1,45 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef FRAMETIMELINE_HPP_W6CJ9TQB
+#define FRAMETIMELINE_HPP_W6CJ9TQB
+
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace gfx {
+	// Tracks GPU completion of the frames submitted to the graphics queue by their (monotonically increasing) index.
+	// NOTE: With Vulkan 1.2 a single timeline semaphore is signalled with `frame + 1` on submission, so its counter
+	//       value is the number of completed frames; older devices fall back to one fence per frame slot.
+	//       Anything that needs "frame N is done" (uploads, deletions, readbacks) can query this cheaply
+	//       instead of owning extra fences.
+	class FrameTimeline final {
+		public:
+			FrameTimeline( vk::raii::Device const &, bool const useTimelineSemaphore, u32 const frameSlotCount );
+			
+			// submits to the queue and signals the completion of `frame` (which must be the next frame):
+			void                submit( vk::raii::Queue const &, vk::SubmitInfo const &, u64 const frame );
+			// blocks until the first `frameCount` frames have completed; false if the timeout (in ns) ran out first:
+			[[nodiscard]] bool  waitFor(      u64 const frameCount, u64 const timeout );
+			[[nodiscard]] bool  hasCompleted( u64 const frameCount );
+			[[nodiscard]] u64   getCompletedFrameCount();
+			[[nodiscard]] u64   getSubmittedFrameCount() const noexcept;
+			[[nodiscard]] bool  isUsingTimelineSemaphore() const noexcept;
+		
+		private:
+			void updateFromFences();
+			
+			vk::raii::Device const               *mpDevice;
+			std::unique_ptr<vk::raii::Semaphore>  mpSemaphore; // null unless timeline semaphores are used
+			std::vector<vk::raii::Fence>          mFences;     // empty   if timeline semaphores are used
+			std::vector<u64>                      mSlotFrames; // frame last submitted with each fence
+			u64                                   mCompletedFrameCount;
+			u64                                   mSubmittedFrameCount;
+	}; // end-of-class: FrameTimeline
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard FRAMETIMELINE_HPP_W6CJ9TQB
+// EOF
@@ -0,0 +1,128 @@
+#include "MyTemplate/Renderer/GeometryBuffer.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <cassert>
+#include <utility>
+
+namespace gfx {
+	GeometryBuffer::GeometryBuffer(
+		std::unique_ptr<Buffer>        pVertexBuffer,
+		u32                     const  vertexCapacity,
+		std::unique_ptr<Buffer>        pIndexBuffer,
+		u32                     const  indexCapacity
+	) noexcept:
+		mpVertexBuffer  { std::move( pVertexBuffer ) },
+		mpIndexBuffer   { std::move( pIndexBuffer  ) },
+		mVertexCapacity { vertexCapacity             },
+		mIndexCapacity  { indexCapacity              },
+		mVertexCount    { 0                          },
+		mIndexCount     { 0                          },
+		mMeshes         {                            }
+	{
+		// pre-condition(s):
+		assert( mpVertexBuffer != nullptr );
+		assert( mpIndexBuffer  != nullptr );
+		//   vertex offsets are signed:
+		assert( vertexCapacity <= static_cast<u32>( max<i32> ) );
+	} // end-of-function: GeometryBuffer::GeometryBuffer
+	
+	
+	
+	[[nodiscard]] std::optional<MeshId>
+	GeometryBuffer::allocate( u32 const vertexCount, u32 const indexCount )
+	{
+		if ( vertexCount > mVertexCapacity - mVertexCount or indexCount > mIndexCapacity - mIndexCount ) [[unlikely]]
+			return std::nullopt;
+		mMeshes.push_back(
+			Mesh {
+				.firstIndex   = mIndexCount,
+				.indexCount   = indexCount,
+				.vertexOffset = static_cast<i32>( mVertexCount ),
+				.vertexCount  = vertexCount,
+				.uploadTicket = {}
+			}
+		);
+		mVertexCount += vertexCount;
+		mIndexCount  += indexCount;
+		return static_cast<MeshId>( mMeshes.size() - 1 );
+	} // end-of-function: GeometryBuffer::allocate
+	
+	
+	
+	void
+	GeometryBuffer::setUploadTicket( MeshId const meshId, UploadTicket const uploadTicket ) noexcept
+	{
+		// pre-condition(s):
+		assert( meshId < mMeshes.size() );
+		
+		mMeshes[meshId].uploadTicket = uploadTicket;
+	} // end-of-function: GeometryBuffer::setUploadTicket
+	
+	
+	
+	[[nodiscard]] Mesh const &
+	GeometryBuffer::getMesh( MeshId const meshId ) const noexcept
+	{
+		// pre-condition(s):
+		assert( meshId < mMeshes.size() );
+		
+		return mMeshes[meshId];
+	} // end-of-function: GeometryBuffer::getMesh
+	
+	
+	
+	[[nodiscard]] DrawCommand
+	GeometryBuffer::makeDrawCommand( MeshId const meshId ) const noexcept
+	{
+		auto const &mesh { getMesh( meshId ) };
+		return DrawCommand {
+			.vertexBuffer = *mpVertexBuffer->handle,
+			.indexBuffer  = *mpIndexBuffer->handle,
+			.indexType    =  vk::IndexType::eUint32,
+			.indexCount   =  mesh.indexCount,
+			.firstIndex   =  mesh.firstIndex,
+			.vertexOffset =  mesh.vertexOffset
+		};
+	} // end-of-function: GeometryBuffer::makeDrawCommand
+	
+	
+	
+	[[nodiscard]] Buffer const &
+	GeometryBuffer::getVertexBuffer() const noexcept
+	{
+		return *mpVertexBuffer;
+	} // end-of-function: GeometryBuffer::getVertexBuffer
+	
+	
+	
+	[[nodiscard]] Buffer const &
+	GeometryBuffer::getIndexBuffer() const noexcept
+	{
+		return *mpIndexBuffer;
+	} // end-of-function: GeometryBuffer::getIndexBuffer
+	
+	
+	
+	[[nodiscard]] u32
+	GeometryBuffer::getMeshCount() const noexcept
+	{
+		return static_cast<u32>( mMeshes.size() );
+	} // end-of-function: GeometryBuffer::getMeshCount
+	
+	
+	
+	[[nodiscard]] u32
+	GeometryBuffer::getVertexCount() const noexcept
+	{
+		return mVertexCount;
+	} // end-of-function: GeometryBuffer::getVertexCount
+	
+	
+	
+	[[nodiscard]] u32
+	GeometryBuffer::getIndexCount() const noexcept
+	{
+		return mIndexCount;
+	} // end-of-function: GeometryBuffer::getIndexCount
+} // end-of-namespace: gfx
+// EOF
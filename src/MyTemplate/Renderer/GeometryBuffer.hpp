@@ -0,0 +1,68 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef GEOMETRYBUFFER_HPP_X5TM3KQB
+#define GEOMETRYBUFFER_HPP_X5TM3KQB
+
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Renderer/UploadService.hpp"
+#include "MyTemplate/Renderer/DrawList.hpp"
+
+#include <vulkan/vulkan.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace gfx {
+	using MeshId = u32; // index into the mesh table
+	
+	// Where a mesh lives in the geometry buffer (in elements rather than bytes, i.e. as `drawIndexed` takes them).
+	struct Mesh final {
+		u32          firstIndex;
+		u32          indexCount;
+		i32          vertexOffset;
+		u32          vertexCount;
+		UploadTicket uploadTicket; // see: Renderer::isMeshReady
+	}; // end-of-struct: Mesh
+	
+	
+	
+	// One device local vertex buffer and one index buffer (with 32-bit indices) shared by every mesh, plus the
+	// table of where each mesh lives in them. Meshes are bump allocated and never freed individually.
+	// NOTE: Since all meshes share the same bindings, recording doesn't rebind any buffers between their draws.
+	class GeometryBuffer final {
+		public:
+			GeometryBuffer(
+				std::unique_ptr<Buffer>        pVertexBuffer,
+				u32                     const  vertexCapacity,
+				std::unique_ptr<Buffer>        pIndexBuffer,
+				u32                     const  indexCapacity
+			) noexcept;
+			GeometryBuffer(             GeometryBuffer const &  ) = delete;
+			GeometryBuffer(             GeometryBuffer       && ) = delete;
+			GeometryBuffer & operator=( GeometryBuffer const &  ) = delete;
+			GeometryBuffer & operator=( GeometryBuffer       && ) = delete;
+			
+			// reserves room for a mesh and adds it to the table; empty if either buffer is full:
+			[[nodiscard]] std::optional<MeshId> allocate( u32 const vertexCount, u32 const indexCount );
+			void                                setUploadTicket( MeshId const, UploadTicket const ) noexcept;
+			[[nodiscard]] Mesh const &          getMesh(         MeshId const ) const noexcept;
+			[[nodiscard]] DrawCommand           makeDrawCommand( MeshId const ) const noexcept;
+			[[nodiscard]] Buffer const &        getVertexBuffer()               const noexcept;
+			[[nodiscard]] Buffer const &        getIndexBuffer()                const noexcept;
+			[[nodiscard]] u32                   getMeshCount()                  const noexcept;
+			[[nodiscard]] u32                   getVertexCount()                const noexcept; // allocated so far
+			[[nodiscard]] u32                   getIndexCount()                 const noexcept; // ditto
+		
+		private:
+			std::unique_ptr<Buffer> mpVertexBuffer;
+			std::unique_ptr<Buffer> mpIndexBuffer;
+			u32                     mVertexCapacity;
+			u32                     mIndexCapacity;
+			u32                     mVertexCount;
+			u32                     mIndexCount;
+			std::vector<Mesh>       mMeshes;
+	}; // end-of-class: GeometryBuffer
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard GEOMETRYBUFFER_HPP_X5TM3KQB
+// EOF
@@ -0,0 +1,342 @@
+#include "MyTemplate/Renderer/GpuProfiler.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/utility.hpp"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <cassert>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		u32 constexpr kWindowSize     { 128      }; // samples per scope for the rolling min/avg/max
+		u64 constexpr kMaxTraceEvents { 1 << 16  };
+		
+		[[nodiscard]] std::string
+		escapeJson( std::string_view const text )
+		{
+			std::string result;
+			result.reserve( text.size() );
+			for ( auto const c: text ) {
+				if ( c == '"' or c == '\\' )
+					result.push_back( '\\' );
+				result.push_back( c );
+			}
+			return result;
+		} // end-of-function: escapeJson
+	} // end-of-unnamed-namespace
+	
+	
+	
+	struct GpuProfiler::FrameSlot final {
+		std::unique_ptr<vk::raii::QueryPool> pQueryPool;  // null if disabled
+		std::vector<u32>                     scopeNames;  // name index per reserved scope
+		u64                                  frame;
+		bool                                 isSubmitted;
+	}; // end-of-struct: GpuProfiler::FrameSlot
+	
+	
+	
+	struct GpuProfiler::History final {
+		std::array<f64,kWindowSize> samplesMs   {};
+		u64                         sampleCount { 0 };
+	}; // end-of-struct: GpuProfiler::History
+	
+	
+	
+	GpuProfiler::GpuProfiler(
+		vk::raii::Device         const &device,
+		vk::raii::PhysicalDevice const &physicalDevice,
+		u32                      const  queueFamilyIndex,
+		u32                      const  frameSlotCount,
+		u32                      const  maxScopesPerFrame
+	):
+		mpDevice        { &device           },
+		mIsEnabled      { false             },
+		mNsPerTick      { 0                 },
+		mTimestampMask  { 0                 },
+		mMaxScopes      { maxScopesPerFrame },
+		mCurrentSlot    { 0                 },
+		mTraceOrigin    { 0                 },
+		mHasTraceOrigin { false             },
+		mLastFrameMs    { 0                 }
+	{
+		spdlog::info( "Creating a GPU profiler..." );
+		
+		auto const timestampPeriod { physicalDevice.getProperties().limits.timestampPeriod };
+		auto const validBits       { physicalDevice.getQueueFamilyProperties()[queueFamilyIndex].timestampValidBits };
+		mIsEnabled     = validBits > 0 and timestampPeriod > 0;
+		mNsPerTick     = static_cast<f64>( timestampPeriod );
+		mTimestampMask = validBits >= 64 ? max<u64> : (u64{1} << validBits) - 1;
+		spdlog::info( "... timestamps: {} ({} valid bits, {} ns/tick)", mIsEnabled ? "supported" : "unsupported", validBits, mNsPerTick );
+		
+		mFrameSlots.resize( frameSlotCount );
+		for ( auto &slot: mFrameSlots ) {
+			slot.frame       = 0;
+			slot.isSubmitted = false;
+			if ( mIsEnabled ) [[likely]] {
+				slot.pQueryPool = std::make_unique<vk::raii::QueryPool>(
+					device,
+					vk::QueryPoolCreateInfo {
+						.queryType  = vk::QueryType::eTimestamp,
+						.queryCount = 2 * mMaxScopes // begin + end per scope
+					}
+				);
+				slot.scopeNames.reserve( mMaxScopes );
+			}
+		}
+	} // end-of-function: GpuProfiler::GpuProfiler
+	
+	
+	
+	GpuProfiler::~GpuProfiler() noexcept = default;
+	
+	
+	
+	void
+	GpuProfiler::beginFrame( u32 const frameSlot, u64 const frame )
+	{
+		// pre-condition(s):
+		assert( frameSlot < mFrameSlots.size() );
+		
+		mCurrentSlot = frameSlot;
+		auto &slot { mFrameSlots[frameSlot] };
+		if ( slot.isSubmitted )
+			resolve( slot );
+		slot.scopeNames.clear();
+		slot.frame       = frame;
+		slot.isSubmitted = false;
+	} // end-of-function: GpuProfiler::beginFrame
+	
+	
+	
+	void
+	GpuProfiler::markSubmitted() noexcept
+	{
+		mFrameSlots[mCurrentSlot].isSubmitted = true;
+	} // end-of-function: GpuProfiler::markSubmitted
+	
+	
+	
+	void
+	GpuProfiler::recordReset( vk::raii::CommandBuffer &commandBuffer ) const
+	{
+		if ( not mIsEnabled ) [[unlikely]]
+			return;
+		commandBuffer.resetQueryPool( **mFrameSlots[mCurrentSlot].pQueryPool, 0, 2 * mMaxScopes );
+	} // end-of-function: GpuProfiler::recordReset
+	
+	
+	
+	[[nodiscard]] GpuProfiler::Scope
+	GpuProfiler::reserveScope( std::string_view const name )
+	{
+		auto &slot { mFrameSlots[mCurrentSlot] };
+		if ( not mIsEnabled or slot.scopeNames.size() == mMaxScopes ) [[unlikely]]
+			return {}; // invalid; timestamps won't be written
+		
+		auto iterator { mNameIndices.find( name ) };
+		if ( iterator == mNameIndices.end() ) [[unlikely]] {
+			iterator = mNameIndices.emplace( std::string { name }, static_cast<u32>( mNames.size() ) ).first;
+			mNames.emplace_back( name );
+			mHistories.emplace_back();
+		}
+		slot.scopeNames.push_back( iterator->second );
+		return Scope { .queryIndex = 2 * static_cast<u32>( slot.scopeNames.size() - 1 ) };
+	} // end-of-function: GpuProfiler::reserveScope
+	
+	
+	
+	void
+	GpuProfiler::writeBegin( vk::raii::CommandBuffer &commandBuffer, Scope const scope ) const
+	{
+		if ( scope.queryIndex == Scope::kInvalid ) [[unlikely]]
+			return;
+		commandBuffer.writeTimestamp(
+			vk::PipelineStageFlagBits::eTopOfPipe,
+			**mFrameSlots[mCurrentSlot].pQueryPool,
+			scope.queryIndex
+		);
+	} // end-of-function: GpuProfiler::writeBegin
+	
+	
+	
+	void
+	GpuProfiler::writeEnd( vk::raii::CommandBuffer &commandBuffer, Scope const scope ) const
+	{
+		if ( scope.queryIndex == Scope::kInvalid ) [[unlikely]]
+			return;
+		commandBuffer.writeTimestamp(
+			vk::PipelineStageFlagBits::eBottomOfPipe,
+			**mFrameSlots[mCurrentSlot].pQueryPool,
+			scope.queryIndex + 1
+		);
+	} // end-of-function: GpuProfiler::writeEnd
+	
+	
+	
+	[[nodiscard]] GpuProfiler::Scope
+	GpuProfiler::beginScope( vk::raii::CommandBuffer &commandBuffer, std::string_view const name )
+	{
+		auto const scope { reserveScope( name ) };
+		writeBegin( commandBuffer, scope );
+		return scope;
+	} // end-of-function: GpuProfiler::beginScope
+	
+	
+	
+	void
+	GpuProfiler::endScope( vk::raii::CommandBuffer &commandBuffer, Scope const scope )
+	{
+		writeEnd( commandBuffer, scope );
+	} // end-of-function: GpuProfiler::endScope
+	
+	
+	
+	[[nodiscard]] bool
+	GpuProfiler::isEnabled() const noexcept
+	{
+		return mIsEnabled;
+	} // end-of-function: GpuProfiler::isEnabled
+	
+	
+	
+	[[nodiscard]] f64
+	GpuProfiler::getLastFrameMs() const noexcept
+	{
+		return mLastFrameMs;
+	} // end-of-function: GpuProfiler::getLastFrameMs
+	
+	
+	
+	[[nodiscard]] std::vector<GpuProfiler::ScopeStats>
+	GpuProfiler::getStats() const
+	{
+		std::vector<ScopeStats> result;
+		result.reserve( mNames.size() );
+		for ( u32 nameIndex{0}; nameIndex < mNames.size(); ++nameIndex ) {
+			auto const &history { mHistories[nameIndex] };
+			if ( history.sampleCount == 0 )
+				continue; // reserved but not resolved yet
+			auto const windowSize { std::min<u64>( history.sampleCount, kWindowSize ) };
+			ScopeStats stats {
+				.name        = mNames[nameIndex],
+				.sampleCount = history.sampleCount,
+				.lastMs      = history.samplesMs[(history.sampleCount - 1) % kWindowSize],
+				.minMs       = max<f64>,
+				.avgMs       = 0,
+				.maxMs       = 0
+			};
+			for ( u64 i{0}; i < windowSize; ++i ) {
+				stats.minMs  = std::min( stats.minMs, history.samplesMs[i] );
+				stats.maxMs  = std::max( stats.maxMs, history.samplesMs[i] );
+				stats.avgMs += history.samplesMs[i];
+			}
+			stats.avgMs /= static_cast<f64>( windowSize );
+			result.push_back( std::move( stats ) );
+		}
+		return result;
+	} // end-of-function: GpuProfiler::getStats
+	
+	
+	
+	void
+	GpuProfiler::logStats() const
+	{
+		for ( auto const &stats: getStats() ) {
+			spdlog::info(
+				"[gpu]: `{}`: {:.3f} ms last, {:.3f} / {:.3f} / {:.3f} ms min/avg/max ({} sample(s))",
+				stats.name, stats.lastMs, stats.minMs, stats.avgMs, stats.maxMs, stats.sampleCount
+			);
+		}
+	} // end-of-function: GpuProfiler::logStats
+	
+	
+	
+	void
+	GpuProfiler::writeChromeTrace( std::filesystem::path const &path ) const
+	{
+		std::ofstream file( path );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { "Failed to open the GPU trace output file!" };
+		
+		// NOTE: GPU timestamps aren't in the same time domain as the CPU clock, so they're traced as their own process
+		file << R"({"traceEvents":[)" "\n";
+		file << R"({"name":"process_name","ph":"M","pid":2,"args":{"name":"GPU"}})";
+		for ( auto const &event: mTraceEvents ) {
+			file << fmt::format(
+				",\n" R"({{"name":"{}","cat":"gpu","ph":"X","pid":2,"tid":0,"ts":{:.3f},"dur":{:.3f},"args":{{"frame":{}}}}})",
+				escapeJson( mNames[event.nameIndex] ), event.beginUs, event.durationUs, event.frame
+			);
+		}
+		file << "\n]}\n";
+		spdlog::info( "Wrote {} GPU trace event(s) to `{}`", mTraceEvents.size(), path.string() );
+	} // end-of-function: GpuProfiler::writeChromeTrace
+	
+	
+	
+	void
+	GpuProfiler::resolve( FrameSlot &slot )
+	{
+		// pre-condition(s):
+		//   the slot's frame has completed:
+		assert( slot.isSubmitted );
+		
+		auto const scopeCount { static_cast<u32>( slot.scopeNames.size() ) };
+		if ( not mIsEnabled or scopeCount == 0 )
+			return;
+		
+		// NOTE: Without eWait this won't block; eNotReady means some scope was never ended, in which case
+		//       the whole frame is skipped rather than reporting garbage.
+		auto const [result, timestamps] {
+			slot.pQueryPool->getResults<u64>(
+				0, 2 * scopeCount, 2 * scopeCount * sizeof(u64), sizeof(u64), vk::QueryResultFlagBits::e64
+			)
+		};
+		if ( result != vk::Result::eSuccess ) [[unlikely]] {
+			spdlog::warn( "[gpu]: timestamps of frame #{} unavailable; skipping", slot.frame );
+			return;
+		}
+		
+		if ( not mHasTraceOrigin ) [[unlikely]] {
+			mTraceOrigin    = timestamps[0] & mTimestampMask;
+			mHasTraceOrigin = true;
+		}
+		f64 frameBeginNs { max<f64> };
+		f64 frameEndNs   { 0        };
+		for ( u32 scopeIndex{0}; scopeIndex < scopeCount; ++scopeIndex ) {
+			auto const begin { timestamps[2 * scopeIndex    ] & mTimestampMask };
+			auto const end   { timestamps[2 * scopeIndex + 1] & mTimestampMask };
+			// NOTE: masking the differences handles the counter wrapping around
+			auto const durationNs { static_cast<f64>( (end   - begin       ) & mTimestampMask ) * mNsPerTick };
+			auto const offsetNs   { static_cast<f64>( (begin - mTraceOrigin) & mTimestampMask ) * mNsPerTick };
+			frameBeginNs = std::min( frameBeginNs, offsetNs              );
+			frameEndNs   = std::max( frameEndNs,   offsetNs + durationNs );
+			auto const nameIndex  { slot.scopeNames[scopeIndex] };
+			auto &history { mHistories[nameIndex] };
+			history.samplesMs[history.sampleCount % kWindowSize] = durationNs / 1e6;
+			history.sampleCount += 1;
+			mTraceEvents.push_back(
+				TraceEvent {
+					.nameIndex  = nameIndex,
+					.frame      = slot.frame,
+					.beginUs    = offsetNs   / 1e3,
+					.durationUs = durationNs / 1e3
+				}
+			);
+			if ( mTraceEvents.size() > kMaxTraceEvents )
+				mTraceEvents.pop_front();
+		}
+		mLastFrameMs = (frameEndNs - frameBeginNs) / 1e6;
+	} // end-of-function: GpuProfiler::resolve
+} // end-of-namespace: gfx
+// EOF
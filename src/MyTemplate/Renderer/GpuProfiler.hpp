@@ -0,0 +1,103 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef GPUPROFILER_HPP_E2HV6KJS
+#define GPUPROFILER_HPP_E2HV6KJS
+
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+
+namespace gfx {
+	// Measures GPU time spent in named scopes with timestamp queries written into one query pool per frame slot.
+	// NOTE: Results are read when a slot is reused, i.e. once its previous frame is known to have completed
+	//       (`frameSlotCount` frames later), so reading them back never stalls.
+	class GpuProfiler final {
+		public:
+			struct Scope final {
+				u32 queryIndex { kInvalid }; // of the begin timestamp; the end timestamp follows it
+				inline static u32 constexpr kInvalid { max<u32> };
+			}; // end-of-struct: GpuProfiler::Scope
+			
+			struct ScopeStats final {
+				std::string name;
+				u64         sampleCount;
+				f64         lastMs;
+				f64         minMs; // within the rolling window
+				f64         avgMs; // ditto
+				f64         maxMs; // ditto
+			}; // end-of-struct: GpuProfiler::ScopeStats
+			
+			GpuProfiler(
+				vk::raii::Device         const &,
+				vk::raii::PhysicalDevice const &,
+				u32                      const  queueFamilyIndex,
+				u32                      const  frameSlotCount,
+				u32                      const  maxScopesPerFrame = 64
+			);
+			~GpuProfiler() noexcept;
+			GpuProfiler(             GpuProfiler const &  ) = delete;
+			GpuProfiler(             GpuProfiler       && ) = delete;
+			GpuProfiler & operator=( GpuProfiler const &  ) = delete;
+			GpuProfiler & operator=( GpuProfiler       && ) = delete;
+			
+			// call once the slot's previous frame has completed; collects its results:
+			void beginFrame( u32 const frameSlot, u64 const frame );
+			// call after the frame has been submitted (results of unsubmitted frames are discarded):
+			void markSubmitted() noexcept;
+			// records the reset of the current slot's queries; must precede any scopes and be outside of render passes:
+			void recordReset( vk::raii::CommandBuffer & ) const;
+			
+			// NOTE: scopes have to be reserved on the recording thread, but their timestamps may then be
+			//       written into any command buffer of the frame (e.g. secondaries recorded by workers):
+			[[nodiscard]] Scope reserveScope( std::string_view const name );
+			void                writeBegin( vk::raii::CommandBuffer &, Scope const ) const;
+			void                writeEnd(   vk::raii::CommandBuffer &, Scope const ) const;
+			[[nodiscard]] Scope beginScope( vk::raii::CommandBuffer &, std::string_view const name ); // reserve + writeBegin
+			void                endScope(   vk::raii::CommandBuffer &, Scope const );                 // writeEnd
+			
+			[[nodiscard]] bool                    isEnabled() const noexcept; // false if the queue lacks timestamp support
+			// span from the first to the last timestamp of the most recently resolved frame (0 if none):
+			[[nodiscard]] f64                     getLastFrameMs() const noexcept;
+			[[nodiscard]] std::vector<ScopeStats> getStats()  const;
+			void                                  logStats()  const;
+			// Chrome trace event JSON (chrome://tracing, Perfetto) of the most recent resolved frames:
+			void                                  writeChromeTrace( std::filesystem::path const & ) const;
+		
+		private:
+			struct FrameSlot;
+			struct History;
+			struct TraceEvent final {
+				u32 nameIndex;
+				u64 frame;
+				f64 beginUs; // relative to the first resolved timestamp
+				f64 durationUs;
+			}; // end-of-struct: GpuProfiler::TraceEvent
+			
+			void resolve( FrameSlot & );
+			
+			vk::raii::Device const                 *mpDevice;
+			bool                                    mIsEnabled;
+			f64                                     mNsPerTick;      // timestampPeriod
+			u64                                     mTimestampMask;  // from timestampValidBits
+			u32                                     mMaxScopes;
+			std::vector<FrameSlot>                  mFrameSlots;
+			u32                                     mCurrentSlot;
+			std::map<std::string,u32,std::less<>>   mNameIndices;    // name -> index into mNames/mHistories
+			std::vector<std::string>                mNames;
+			std::vector<History>                    mHistories;
+			std::deque<TraceEvent>                  mTraceEvents;    // bounded
+			u64                                     mTraceOrigin;    // first resolved timestamp (in ticks)
+			bool                                    mHasTraceOrigin;
+			f64                                     mLastFrameMs;
+	}; // end-of-class: GpuProfiler
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard GPUPROFILER_HPP_E2HV6KJS
+// EOF
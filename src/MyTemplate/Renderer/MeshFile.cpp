@@ -0,0 +1,128 @@
+#include "MyTemplate/Renderer/MeshFile.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/Profiler.hpp"
+#include "MyTemplate/Common/utility.hpp"
+
+#define CGLTF_IMPLEMENTATION // NOTE: the only translation unit that compiles cgltf
+#include <cgltf.h>
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		using GltfData = std::unique_ptr<cgltf_data,decltype(&cgltf_free)>;
+		
+		[[nodiscard]] cgltf_accessor const *
+		findAttribute( cgltf_primitive const &primitive, cgltf_attribute_type const type ) noexcept
+		{
+			for ( cgltf_size i{0}; i < primitive.attributes_count; ++i )
+				if ( auto const &attribute { primitive.attributes[i] }; attribute.type == type and attribute.index == 0 )
+					return attribute.data;
+			return nullptr;
+		} // end-of-function: findAttribute
+		
+		// NOTE: handles normalized integer components and sparse accessors (unlike reading elements one by one)
+		[[nodiscard]] std::vector<f32>
+		unpackFloats( cgltf_accessor const &accessor, std::filesystem::path const &path )
+		{
+			std::vector<f32> floats( accessor.count * cgltf_num_components( accessor.type ) );
+			if ( cgltf_accessor_unpack_floats( &accessor, floats.data(), floats.size() ) != floats.size() ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` has an unreadable vertex attribute!", path.string() ) };
+			return floats;
+		} // end-of-function: unpackFloats
+		
+		[[nodiscard]] MeshData
+		convertPrimitive( cgltf_primitive const &primitive, std::string name, std::filesystem::path const &path )
+		{
+			auto const *pPositions { findAttribute( primitive, cgltf_attribute_type_position ) };
+			auto const *pColors    { findAttribute( primitive, cgltf_attribute_type_color    ) };
+			if ( pPositions == nullptr or cgltf_num_components( pPositions->type ) != 3 ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` has a primitive (`{}`) without 3D positions!", path.string(), name ) };
+			auto const vertexCount { pPositions->count };
+			if ( vertexCount == 0 or vertexCount > static_cast<cgltf_size>( max<i32> ) ) [[unlikely]] // NOTE: vertex offsets are signed 32-bit
+				throw std::runtime_error { fmt::format( "`{}` has a primitive (`{}`) with {} vertices!", path.string(), name, vertexCount ) };
+			if ( pColors != nullptr and pColors->count != vertexCount ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` has a primitive (`{}`) with mismatched attributes!", path.string(), name ) };
+			
+			MeshData mesh { .name = std::move( name ), .vertices = {}, .indices = {} };
+			auto const positions { unpackFloats( *pPositions, path ) };
+			mesh.vertices.resize( vertexCount );
+			for ( cgltf_size i{0}; i < vertexCount; ++i ) {
+				mesh.vertices[i].xy  = { positions[i*3], positions[i*3+1] };
+				mesh.vertices[i].rgb = { 1.0f, 1.0f, 1.0f };
+			}
+			if ( pColors != nullptr ) {
+				auto const colors         { unpackFloats( *pColors, path ) };
+				auto const componentCount { cgltf_num_components( pColors->type ) }; // RGB or RGBA
+				for ( cgltf_size i{0}; i < vertexCount; ++i )
+					mesh.vertices[i].rgb = { colors[i*componentCount], colors[i*componentCount+1], colors[i*componentCount+2] };
+			}
+			
+			if ( primitive.indices != nullptr ) {
+				mesh.indices.resize( primitive.indices->count );
+				for ( cgltf_size i{0}; i < mesh.indices.size(); ++i ) {
+					auto const index { cgltf_accessor_read_index( primitive.indices, i ) };
+					if ( index >= vertexCount ) [[unlikely]]
+						throw std::runtime_error { fmt::format( "`{}` has a primitive (`{}`) with an index out of range!", path.string(), mesh.name ) };
+					mesh.indices[i] = static_cast<u32>( index );
+				}
+			}
+			else { // i.e. non-indexed
+				mesh.indices.resize( vertexCount );
+				std::iota( mesh.indices.begin(), mesh.indices.end(), 0u );
+			}
+			if ( mesh.indices.empty() or mesh.indices.size() % 3 != 0 ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` has a primitive (`{}`) that isn't a triangle list!", path.string(), mesh.name ) };
+			return mesh;
+		} // end-of-function: convertPrimitive
+	} // end-of-unnamed-namespace
+	
+	
+	
+	void
+	MeshFile::loadFile( std::filesystem::path const &path )
+	{
+		PROFILE_FUNCTION();
+		
+		cgltf_options const options {};
+		cgltf_data *pData { nullptr };
+		if ( cgltf_parse_file( &options, path.c_str(), &pData ) != cgltf_result_success ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` isn't a glTF 2.0 file!", path.string() ) };
+		GltfData const data { pData, &cgltf_free };
+		if ( cgltf_load_buffers( &options, pData, path.c_str() ) != cgltf_result_success ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to load the buffers of `{}`!", path.string() ) };
+		if ( cgltf_validate( pData ) != cgltf_result_success ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` is malformed!", path.string() ) };
+		
+		u64 fileByteSize { std::filesystem::file_size( path ) };
+		for ( cgltf_size i{0}; i < data->buffers_count; ++i )
+			if ( auto const *uri { data->buffers[i].uri }; uri != nullptr and std::strncmp( uri, "data:", 5 ) != 0 )
+				fileByteSize += data->buffers[i].size; // i.e. an external buffer
+		
+		std::vector<MeshData> fileMeshes;
+		for ( cgltf_size meshIndex{0}; meshIndex < data->meshes_count; ++meshIndex ) {
+			auto const &mesh     { data->meshes[meshIndex] };
+			auto const  meshName { mesh.name != nullptr ? std::string { mesh.name } : std::to_string( meshIndex ) };
+			for ( cgltf_size primitiveIndex{0}; primitiveIndex < mesh.primitives_count; ++primitiveIndex ) {
+				auto const &primitive { mesh.primitives[primitiveIndex] };
+				auto        name      { fmt::format( "{}/{}", meshName, primitiveIndex ) };
+				if ( primitive.type != cgltf_primitive_type_triangles ) [[unlikely]] {
+					spdlog::warn( "Skipping the primitive `{}` of `{}` since it isn't a triangle list", name, path.string() );
+					continue;
+				}
+				fileMeshes.push_back( convertPrimitive( primitive, std::move( name ), path ) );
+			}
+		}
+		
+		meshes   = std::move( fileMeshes );
+		byteSize = fileByteSize;
+	} // end-of-function: MeshFile::loadFile
+} // end-of-namespace: gfx
+// EOF
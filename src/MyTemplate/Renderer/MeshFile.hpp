@@ -0,0 +1,35 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef MESHFILE_HPP_Q2WK8JDN
+#define MESHFILE_HPP_Q2WK8JDN
+
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Renderer/Primitives.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace gfx {
+	// Indexed triangle list in the renderer's vertex format (see: Renderer::loadMeshes).
+	struct MeshData final {
+		std::string           name;     // the glTF mesh name (or index) and primitive index, e.g. "Cube/0"
+		std::vector<Vertex2D> vertices;
+		std::vector<u32>      indices;
+	}; // end-of-struct: MeshData
+	
+	
+	
+	// Meshes of a glTF 2.0 file (i.e. `.gltf` with external or embedded buffers, or binary `.glb`), parsed with cgltf.
+	// NOTE: Every triangle list primitive becomes a mesh of its own; other primitive types are skipped.
+	//       Only POSITION and COLOR_0 (white if absent) are converted, and node transforms aren't applied.
+	//       Since the pipeline's vertices are 2D (see: Vertex2D), the z coordinates are dropped.
+	struct MeshFile final {
+		std::vector<MeshData> meshes   {   };
+		u64                   byteSize { 0 }; // of the file and its external buffers (e.g. for throughput stats)
+		
+		void loadFile( std::filesystem::path const & ); // throws if the file is malformed or unsupported
+	}; // end-of-struct: MeshFile
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard MESHFILE_HPP_Q2WK8JDN
+// EOF
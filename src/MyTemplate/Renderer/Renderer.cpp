@@ -1,10 +1,24 @@
 #include "MyTemplate/Renderer/Renderer.hpp"
 #include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/Profiler.hpp"
+#include "MyTemplate/Common/Logging.hpp"
 #include "MyTemplate/Renderer/common.hpp"	
 #include "MyTemplate/Renderer/GlfwInstance.hpp"
 #include "MyTemplate/Renderer/Window.hpp"
 #include "MyTemplate/Renderer/Primitives.hpp"
+#include "MyTemplate/Renderer/Allocator.hpp"
+#include "MyTemplate/Renderer/UploadService.hpp"
+#include "MyTemplate/Renderer/StagingRing.hpp"
+#include "MyTemplate/Renderer/UniformRing.hpp"
+#include "MyTemplate/Renderer/Uniforms.hpp"
+#include "MyTemplate/Renderer/SamplerCache.hpp"
+#include "MyTemplate/Renderer/Texture.hpp"
+#include "MyTemplate/Renderer/TextureFile.hpp"
+#include "MyTemplate/Renderer/GeometryBuffer.hpp"
+#include "MyTemplate/Renderer/MeshFile.hpp"
+#include "MyTemplate/Common/BlockCompression.hpp"
 
+#include <fmt/core.h>
 #include <spdlog/spdlog.h>
 
 #include <ranges>
@@ -14,10 +28,14 @@
 #include <vector>
 #include <set>
 #include <fstream>
+#include <filesystem>
+#include <chrono>
 #include <memory>
+#include <cstring>
 #include <cassert>
+#include <utility>
+#include <bit>
 
-// TODO(later): Switch over to a custom allocator (e.g. for buffers) later, such as VulkanMemoryAllocator
 // TODO(later): Use a single buffer for shared attributes (verts, indices, etc)
 // TODO(later): Look into aliasing (memory buffer reuse)
 
@@ -25,10 +43,24 @@ namespace gfx {
 	namespace { // private (file-scope)
 		// TODO(config): refactor
 		u64                         constexpr kDrawWaitTimeout            { max<u64>                                 };
-		u32                         constexpr kMaxConcurrentFrames        { 3                                        };
-		PresentationPriority        constexpr kPresentationPriority       { PresentationPriority::eMinimalStuttering };
-		FramebufferingPriority      constexpr kFramebufferingPriority     { FramebufferingPriority::eTriple          };
+		u64                         constexpr kFrameWaitTimeout           { 1'000'000'000                            }; // 1 s (in ns); then logged and retried
+		vk::DeviceSize              constexpr kUniformRingRegionSize      {  1ull * 1024 * 1024                      }; // 1 MiB per frame slot (initially)
+		u32                         constexpr kGeometryVertexCapacity     {  1u << 20                                }; // 20 MiB of `Vertex2D`s
+		u32                         constexpr kGeometryIndexCapacity      {  4u << 20                                }; // 16 MiB of 32-bit indices
+		u32                         constexpr kMaxTextureCount            {  4'096                                   }; // live textures (i.e. descriptor sets in the texture pool)
+		u32                         constexpr kDefaultTextureSize         {  256                                     }; // in texels (square)
+		u32                         constexpr kDefaultTextureTileSize     {  32                                      }; // in texels; of its checkerboard
+		u64                         constexpr kRecordingStatsInterval     { 1'000                                    }; // in frames
+		u64                         constexpr kLatencyStatsInterval       { 1'000                                    }; // in frames
+		u64                         constexpr kMinDrawsPerRecordingSlice  { 1'024                                    }; // below this, recording stays inline
 		std::array                  constexpr kRequiredDeviceExtensions   { VK_KHR_SWAPCHAIN_EXTENSION_NAME          };
+		std::array                  constexpr kOptionalDeviceExtensions   { VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME };
+		char const                  constexpr kPipelineCacheFilename[]    { "pipeline_cache.bin"                     };
+		char const                  constexpr kAssetDirectory[]           { "../dat/"                                }; // for assets loaded per file
+		char const                  constexpr kAssetPackageFilename[]     { "../dat/assets.pak"                      }; // see: the MyTemplateAssetPacker tool
+		vk::Format                  constexpr kHeadlessColorFormat        { vk::Format::eR8G8B8A8Unorm               }; // color attachment support is mandatory
+		std::array                  constexpr kDepthFormatCandidates      { vk::Format::eD32Sfloat, vk::Format::eX8D24UnormPack32, vk::Format::eD24UnormS8Uint, vk::Format::eD16Unorm }; // most precise first
+		char const                  constexpr kGpuTraceFilename[]         { "gpu_trace.json"                         }; // written on exit in debug builds
 		#if !defined( NDEBUG )
 		std::array                  constexpr kRequiredValidationLayers   { "VK_LAYER_KHRONOS_validation"            };
 		std::array                  constexpr kRequiredInstanceExtensions { VK_EXT_DEBUG_UTILS_EXTENSION_NAME        };
@@ -38,6 +70,27 @@ namespace gfx {
 		#endif
 		
 		
+		// adds the lifetime of the object (in milliseconds) to the referenced value:
+		class ScopedTimer final {
+			public:
+				explicit ScopedTimer( f64 &ms ) noexcept:
+					mMs    { ms                               },
+					mStart { std::chrono::steady_clock::now() }
+				{}
+				~ScopedTimer() noexcept
+				{
+					mMs += std::chrono::duration<f64,std::milli>( std::chrono::steady_clock::now() - mStart ).count();
+				}
+				ScopedTimer(             ScopedTimer const &  ) = delete;
+				ScopedTimer(             ScopedTimer       && ) = delete;
+				ScopedTimer & operator=( ScopedTimer const &  ) = delete;
+				ScopedTimer & operator=( ScopedTimer       && ) = delete;
+			
+			private:
+				f64                                   &mMs;
+				std::chrono::steady_clock::time_point  mStart;
+		}; // end-of-class: ScopedTimer
+		
 		#if !defined( NDEBUG )
 			VKAPI_ATTR VkBool32 VKAPI_CALL
 			debugCallback(
@@ -47,9 +100,10 @@ namespace gfx {
 				void * // unused for now
 			)
 			{
-				// TODO: replace invocation duplication by using a function map?
-				auto const msgTypeName {
-					vk::to_string(static_cast<vk::DebugUtilsMessageTypeFlagsEXT>(msgType) )
+				// NOTE: The message type is only turned into a string by the log statement that ends up
+				//       printing it, so filtered out messages (e.g. verbose ones) cost next to nothing.
+				auto const msgTypeFlags {
+					static_cast<vk::DebugUtilsMessageTypeFlagsEXT>(msgType)
 				};
 				auto const msgSeverityLevel {
 					static_cast<vk::DebugUtilsMessageSeverityFlagBitsEXT>(msgSeverity)
@@ -59,24 +113,19 @@ namespace gfx {
 				auto const &pMsg       { fpCallbackData->pMessage        };
 				switch (msgSeverityLevel) {
 					[[unlikely]] case vk::DebugUtilsMessageSeverityFlagBitsEXT::eError: {
-						spdlog::error( "{} | {} | {}: {}", msgTypeName, pMsgIdName, msgId, pMsg );
-						//spdlog::error( "{}: {}", msgTypeName, pMsg );
+						LOG_ERROR( "{} | {} | {}: {}", vk::to_string(msgTypeFlags), pMsgIdName, msgId, pMsg );
 						break;
 					}
 					[[likely]] case vk::DebugUtilsMessageSeverityFlagBitsEXT::eInfo: {
-						spdlog::info( "{} | {} | {}: {}", msgTypeName, pMsgIdName, msgId, pMsg );
-						//spdlog::info( "{}: {}", msgTypeName, pMsg );
+						LOG_INFO( "{} | {} | {}: {}", vk::to_string(msgTypeFlags), pMsgIdName, msgId, pMsg );
 						break;
 					}
 					case vk::DebugUtilsMessageSeverityFlagBitsEXT::eVerbose: { // TODO: contemplate a better fit
-						spdlog::debug( "{} | {} | {}: {}", msgTypeName, pMsgIdName, msgId, pMsg );
-						//spdlog::debug( "{}: {}", msgTypeName, pMsg );
+						LOG_DEBUG( "{} | {} | {}: {}", vk::to_string(msgTypeFlags), pMsgIdName, msgId, pMsg );
 						break;
 					}
 					[[unlikely]] case vk::DebugUtilsMessageSeverityFlagBitsEXT::eWarning: {
-						//spdlog::warn( "[{}] {} (#{}): {}", msgTypeName, pMsgIdName, msgId, pMsg );
-						spdlog::warn( "{} | {} | {}: {}", msgTypeName, pMsgIdName, msgId, pMsg );
-						//spdlog::warn( "{}: {}", msgTypeName, pMsg );
+						LOG_WARN( "{} | {} | {}: {}", vk::to_string(msgTypeFlags), pMsgIdName, msgId, pMsg );
 						break;
 					}
 				}
@@ -107,25 +156,52 @@ namespace gfx {
 				throw std::runtime_error { "Failed to load binary file!" };
 			}
 		} // end-of-function: loadBinaryFromFile()
-	} // end-of-unnamed-namespace	
-	
-	
-	
-	[[nodiscard]] u32
-	Renderer::findMemoryTypeIndex( u32 const typeFilter, vk::MemoryPropertyFlags const flags ) const
-	{
-		// pre-condition(s):
-		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpPhysicalDevice != nullptr );
 		
-		auto const memoryProperties { mpPhysicalDevice->getMemoryProperties() };
-		for ( u32 i{0};  i < memoryProperties.memoryTypeCount;  ++i ) 
-			if ( (typeFilter & (1 << i))
-			and  (memoryProperties.memoryTypes[i].propertyFlags & flags) == flags )
-				return i;
-		
-		throw std::runtime_error { "Unable to find an index of a suitable memory type!" };
-	} // end-of-function: Renderer::findMemoryTypeIndex
+		// NOTE: validates the header that prefixes all pipeline cache data (VkPipelineCacheHeaderVersionOne)
+		[[nodiscard]] bool
+		isPipelineCacheCompatible( std::vector<char> const &cacheData, vk::PhysicalDeviceProperties const &properties )
+		{
+			std::size_t constexpr kHeaderSize { 4 * sizeof(u32) + VK_UUID_SIZE };
+			if ( cacheData.size() < kHeaderSize ) [[unlikely]]
+				return false;
+			u32 header[4]; // header size, header version, vendor ID, device ID
+			std::memcpy( header, cacheData.data(), sizeof(header) );
+			return header[0] >= kHeaderSize
+			   and header[1] == static_cast<u32>( vk::PipelineCacheHeaderVersion::eOne )
+			   and header[2] == properties.vendorID
+			   and header[3] == properties.deviceID
+			   and std::memcmp( cacheData.data() + sizeof(header), properties.pipelineCacheUUID.data(), VK_UUID_SIZE ) == 0;
+		} // end-of-function: isPipelineCacheCompatible
+		
+		// of the tightly packed texels of a single mip level; 0 if the format is unsupported:
+		[[nodiscard]] u64
+		getImageByteSize( vk::Format const format, vk::Extent2D const extent ) noexcept
+		{
+			if ( auto const blockCompressedByteSize { getLevelByteSize( format, extent ) }; blockCompressedByteSize > 0 )
+				return blockCompressedByteSize;
+			u64 texelByteSize { 0 };
+			switch ( format ) {
+				case vk::Format::eR8Unorm:
+				case vk::Format::eR8Srgb:                  texelByteSize =  1; break;
+				case vk::Format::eR8G8Unorm:
+				case vk::Format::eR8G8Srgb:                texelByteSize =  2; break;
+				case vk::Format::eR8G8B8A8Unorm:
+				case vk::Format::eR8G8B8A8Srgb:
+				case vk::Format::eB8G8R8A8Unorm:
+				case vk::Format::eB8G8R8A8Srgb:
+				case vk::Format::eA2B10G10R10UnormPack32:
+				case vk::Format::eB10G11R11UfloatPack32:
+				case vk::Format::eR16G16Sfloat:
+				case vk::Format::eR32Sfloat:               texelByteSize =  4; break;
+				case vk::Format::eR16G16B16A16Unorm:
+				case vk::Format::eR16G16B16A16Sfloat:
+				case vk::Format::eR32G32Sfloat:            texelByteSize =  8; break;
+				case vk::Format::eR32G32B32A32Sfloat:      texelByteSize = 16; break;
+				default:                                   break;
+			}
+			return u64{ extent.width } * u64{ extent.height } * texelByteSize;
+		} // end-of-function: getImageByteSize
+	} // end-of-unnamed-namespace	
 	
 	
 	
@@ -180,18 +256,19 @@ namespace gfx {
 		
 		// pre-condition(s):
 		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpGlfwInstance != nullptr      );
-		assert( mpVkContext    != nullptr      );
+		assert( mpGlfwInstance != nullptr or isHeadless() );
+		assert( mpVkContext    != nullptr                 );
 		//   should be empty unless the function has been called multiple times (which it shouldn't)
 		assert( mInstanceExtensions.empty() );
 		
-		auto const availableExtensions    { mpVkContext->enumerateInstanceExtensionProperties() };
-		auto const glfwRequiredExtensions { mpGlfwInstance->getRequiredExtensions()             };
+		auto const availableExtensions { mpVkContext->enumerateInstanceExtensionProperties() };
 		
 		// make a union of all instance extensions requirements:
+		// NOTE: nothing is presented in headless mode so the surface extensions required by GLFW aren't needed
 		std::set<char const *> allRequiredExtensions {};
-		for ( auto const &requiredExtension: glfwRequiredExtensions )
-			allRequiredExtensions.insert( requiredExtension );
+		if ( not isHeadless() ) [[likely]]
+			for ( auto const &requiredExtension: mpGlfwInstance->getRequiredExtensions() )
+				allRequiredExtensions.insert( requiredExtension );
 		for ( auto const &requiredExtension: kRequiredInstanceExtensions )
 			allRequiredExtensions.insert( requiredExtension );
 		
@@ -227,6 +304,17 @@ namespace gfx {
 	
 	
 	
+	[[nodiscard]] std::span<char const * const>
+	Renderer::getRequiredDeviceExtensions() const noexcept
+	{
+		// NOTE: no swapchain is made in headless mode
+		if ( isHeadless() ) [[unlikely]]
+			return {};
+		return kRequiredDeviceExtensions;
+	} // end-of-function: Renderer::getRequiredDeviceExtensions
+	
+	
+	
 	[[nodiscard]] bool
 	Renderer::meetsDeviceExtensionRequirements( vk::raii::PhysicalDevice const &physicalDevice ) const
 	{
@@ -236,7 +324,7 @@ namespace gfx {
 		if constexpr ( kIsDebugMode ) {
 			spdlog::info( "... checking device extension support:" );
 			// print required and available device extensions:
-			for ( auto const &requiredExtension: kRequiredDeviceExtensions )
+			for ( auto const &requiredExtension: getRequiredDeviceExtensions() )
 				spdlog::info( "      required  : `{}`", requiredExtension );
 			if constexpr ( kIsVerbose )
    			for ( auto const &availableExtension: availableExtensions )
@@ -244,7 +332,7 @@ namespace gfx {
 		}	
 		
 		bool isAdequate { true }; // assume true until proven otherwise
-		for ( auto const &requiredExtension: kRequiredDeviceExtensions ) { // TODO: make gRequiredDeviceExtensions a member
+		for ( auto const &requiredExtension: getRequiredDeviceExtensions() ) {
 			bool isSupported { false }; // assume false until found
 			for ( auto const &availableExtension: availableExtensions ) {
 				if ( std::strcmp( requiredExtension, availableExtension.extensionName ) == 0 ) [[unlikely]] {
@@ -373,12 +461,20 @@ namespace gfx {
 				MYTEMPLATE_VERSION_PATCH
 			)
 		};
+		// NOTE: 1.2 is requested when the loader supports it (for timeline semaphores); 1.1 is the fallback.
+		auto const loaderVersion { mpVkContext->enumerateInstanceVersion() };
+		mApiVersion = loaderVersion >= VK_API_VERSION_1_2 ? VK_API_VERSION_1_2 : VK_API_VERSION_1_1;
+		spdlog::info(
+			"... loader supports Vulkan {}.{}; requesting {}.{}",
+			VK_API_VERSION_MAJOR( loaderVersion ), VK_API_VERSION_MINOR( loaderVersion ),
+			VK_API_VERSION_MAJOR( mApiVersion   ), VK_API_VERSION_MINOR( mApiVersion   )
+		);
 		vk::ApplicationInfo const appInfo {
 			.pApplicationName   = "MyTemplate App", // TODO: make customization point 
 			.applicationVersion = version,          // TODO: make customization point 
 			.pEngineName        = "MyTemplate Engine",
 			.engineVersion      = version,
-			.apiVersion         = VK_API_VERSION_1_1
+			.apiVersion         = mApiVersion
 		};
 		
 		enableValidationLayers();
@@ -444,8 +540,8 @@ namespace gfx {
 		
 		// pre-condition(s):
 		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpWindow         != nullptr );
-		assert( mpPhysicalDevice != nullptr );
+		assert( mpWindow         != nullptr or isHeadless() );
+		assert( mpPhysicalDevice != nullptr                 );
 		//   should be undefined unless the function has been called multiple times (which it shouldn't)
 		assert( mQueueFamilyIndices.presentIndex  == QueueFamilyIndices::kUndefined );
 		assert( mQueueFamilyIndices.graphicsIndex == QueueFamilyIndices::kUndefined );
@@ -459,7 +555,10 @@ namespace gfx {
 		
 		for ( u32 index{0};  index < queueFamilyProperties.size();  ++index ) {
 			bool const supportsGraphics { queueFamilyProperties[index].queueFlags & vk::QueueFlagBits::eGraphics };
-			bool const supportsPresent  { mpPhysicalDevice->getSurfaceSupportKHR( index, *mpWindow->getSurface() ) == VK_TRUE };
+			// NOTE: nothing is presented in headless mode, so the graphics queue family stands in for present:
+			bool const supportsPresent  {
+				isHeadless() ? supportsGraphics : mpPhysicalDevice->getSurfaceSupportKHR( index, *mpWindow->getSurface() ) == VK_TRUE
+			};
 			bool const supportsTransfer { queueFamilyProperties[index].queueFlags & vk::QueueFlagBits::eTransfer };
 			
 			spdlog::info( "... Evaluating queue family index {}:", index );
@@ -481,7 +580,13 @@ namespace gfx {
 				maybeTransferIndex = index;
 		}
 		
-		if ( maybePresentIndex.has_value() and maybeGraphicsIndex.has_value() and maybeTransferIndex.value() ) [[likely]] {
+		// fall back on the graphics queue family for transfers if there's no dedicated transfer queue family:
+		if ( not maybeTransferIndex.has_value() and maybeGraphicsIndex.has_value() ) [[unlikely]] {
+			spdlog::info( "... no dedicated transfer queue family; falling back on the graphics queue family" );
+			maybeTransferIndex = maybeGraphicsIndex;
+		}
+		
+		if ( maybePresentIndex.has_value() and maybeGraphicsIndex.has_value() and maybeTransferIndex.has_value() ) [[likely]] {
 			mQueueFamilyIndices = QueueFamilyIndices {
 				.presentIndex  = maybePresentIndex.value(),
 				.graphicsIndex = maybeGraphicsIndex.value(),
@@ -512,6 +617,22 @@ namespace gfx {
 		//   should be null unless the function has been called multiple times (which it shouldn't):
 		assert( mpDevice                          == nullptr                        ); 
 		
+		// required device extensions have already been verified by calculateScore; optional ones are enabled if available:
+		auto const availableExtensions { mpPhysicalDevice->enumerateDeviceExtensionProperties() };
+		auto const requiredExtensions { getRequiredDeviceExtensions() };
+		mDeviceExtensions.assign( requiredExtensions.begin(), requiredExtensions.end() );
+		for ( auto const &optionalExtension: kOptionalDeviceExtensions ) {
+			bool const isSupported {
+				std::ranges::any_of(
+					availableExtensions,
+					[&]( auto const &available ) { return std::strcmp( optionalExtension, available.extensionName ) == 0; }
+				)
+			};
+			spdlog::info( "... optional device extension `{}`: {}", optionalExtension, isSupported ? "enabled" : "unavailable" );
+			if ( isSupported )
+				mDeviceExtensions.push_back( optionalExtension );
+		}
+		
 		// TODO: refactor approach when more queues are needed
 		std::vector<vk::DeviceQueueCreateInfo> createInfos {};
 		
@@ -536,23 +657,40 @@ namespace gfx {
 			);
 		}
 		
-		createInfos.push_back(
-			vk::DeviceQueueCreateInfo {
-				.queueFamilyIndex =  mQueueFamilyIndices.transferIndex,
-				.queueCount       =  1,
-				.pQueuePriorities = &presentQueuePriority
-			}
-		);
+		// NOTE: each queue family may only be listed once
+		if ( mQueueFamilyIndices.transferIndex != mQueueFamilyIndices.presentIndex
+		and  mQueueFamilyIndices.transferIndex != mQueueFamilyIndices.graphicsIndex ) [[likely]] {
+			createInfos.push_back(
+				vk::DeviceQueueCreateInfo {
+					.queueFamilyIndex =  mQueueFamilyIndices.transferIndex,
+					.queueCount       =  1,
+					.pQueuePriorities = &presentQueuePriority
+				}
+			);
+		}
+		
+		// timeline semaphores are core in 1.2 but still have to be supported by both the instance and the device:
+		vk::PhysicalDeviceVulkan12Features enabledVulkan12Features {};
+		if ( mApiVersion >= VK_API_VERSION_1_2
+		and  mpPhysicalDevice->getProperties().apiVersion >= VK_API_VERSION_1_2 ) [[likely]] {
+			auto const supportedFeatures {
+				mpPhysicalDevice->getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>()
+			};
+			mHasTimelineSemaphores = supportedFeatures.get<vk::PhysicalDeviceVulkan12Features>().timelineSemaphore;
+			enabledVulkan12Features.timelineSemaphore = mHasTimelineSemaphores;
+		}
+		spdlog::info( "... timeline semaphores: {}", mHasTimelineSemaphores ? "enabled" : "unavailable" );
 		
 		mpDevice = std::make_unique<vk::raii::Device>(
 			*mpPhysicalDevice,
 			vk::DeviceCreateInfo {
+				.pNext                   = mHasTimelineSemaphores ? &enabledVulkan12Features : nullptr,
 				.queueCreateInfoCount    = static_cast<u32>( createInfos.size() ),
 				.pQueueCreateInfos       = createInfos.data(),
 				.enabledLayerCount       = 0,       // TODO(verify): deprecated
 				.ppEnabledLayerNames     = nullptr, // TODO(verify): deprecated
-				.enabledExtensionCount   = static_cast<u32>( kRequiredDeviceExtensions.size() ), // TODO(member)
-				.ppEnabledExtensionNames = kRequiredDeviceExtensions.data(),                     // TODO(member)
+				.enabledExtensionCount   = static_cast<u32>( mDeviceExtensions.size() ),
+				.ppEnabledExtensionNames = mDeviceExtensions.data(),
 			}
 		);
 	} // end-of-function: Renderer::makeLogicalDevice
@@ -606,39 +744,57 @@ namespace gfx {
 		// pre-condition(s):
 		//   shouldn't be null or undefined unless the function is called in the wrong order:
 		assert( mpGraphicsQueue                   != nullptr                        ); 
-		assert( mpTransferQueue                   != nullptr                        ); 
 		assert( mQueueFamilyIndices.graphicsIndex != QueueFamilyIndices::kUndefined ); 
-		assert( mQueueFamilyIndices.transferIndex != QueueFamilyIndices::kUndefined ); 
-		//   should be null unless the function has been called multiple times (which it shouldn't):
-		assert( mpGraphicsCommandPool == nullptr ); 
-		assert( mpTransferCommandPool == nullptr ); 
-		
-		spdlog::info( "... creating a graphics command buffer pool" );
-		mpGraphicsCommandPool = std::make_unique<vk::raii::CommandPool>(
-			*mpDevice,
-			vk::CommandPoolCreateInfo {
-				// NOTE: Flags can be set here to optimize for lifetime or enable resetability.
-				//       Also, one pool would be needed for each queue family (if ever extended).
-				.queueFamilyIndex = mQueueFamilyIndices.graphicsIndex
+		//   should be empty unless the function has been called multiple times (which it shouldn't):
+		assert( mFrameContexts.empty() ); 
+		
+		//   the worker count dictates the number of secondary command pools:
+		assert( mpWorkerPool != nullptr );
+		
+		auto const makeCommandContext {
+			[this]( vk::CommandBufferLevel const level ) {
+				auto pCommandPool = std::make_unique<vk::raii::CommandPool>(
+					*mpDevice,
+					vk::CommandPoolCreateInfo {
+						// NOTE: No eResetCommandBuffer; the whole pool is reset at once, which is the cheapest path.
+						.flags            = vk::CommandPoolCreateFlagBits::eTransient,
+						.queueFamilyIndex = mQueueFamilyIndices.graphicsIndex
+					}
+				);
+				auto pCommandBuffers = makeCommandBuffers( *pCommandPool, level, 1 );
+				return CommandContext {
+					.pCommandPool    = std::move( pCommandPool    ),
+					.pCommandBuffers = std::move( pCommandBuffers )
+				};
 			}
-		);
+		};
 		
-		spdlog::info( "... creating a graphics command buffer pool" );
-		mpTransferCommandPool = std::make_unique<vk::raii::CommandPool>(
-			*mpDevice,
-			vk::CommandPoolCreateInfo {
-				// NOTE: Flags can be set here to optimize for lifetime or enable resetability.
-				//       Also, one pool would be needed for each queue family (if ever extended).
-				.queueFamilyIndex = mQueueFamilyIndices.transferIndex
-			}
+		auto const workerCount { mpWorkerPool->getWorkerCount() };
+		spdlog::info(
+			"... creating {} transient graphics command buffer pool(s) ({} primary + {} secondary per frame)",
+			RendererConfig::kMaxFramesInFlight * (1 + workerCount), 1, workerCount
 		);
+		// NOTE: made for the maximum frames in flight so that changing the config never has to remake them
+		mFrameContexts.reserve( RendererConfig::kMaxFramesInFlight );
+		for ( auto i{0u}; i < RendererConfig::kMaxFramesInFlight; ++i ) {
+			FrameContext frameContext {
+				.primary     = makeCommandContext( vk::CommandBufferLevel::ePrimary ),
+				.secondaries = {}
+			};
+			frameContext.secondaries.reserve( workerCount );
+			for ( auto j{0u}; j < workerCount; ++j )
+				frameContext.secondaries.push_back( makeCommandContext( vk::CommandBufferLevel::eSecondary ) );
+			mFrameContexts.push_back( std::move( frameContext ) );
+		}
+		// NOTE: transfer command pools are owned by the UploadService
 	} // end-of-function: Renderer::makeCommandPools
 	
 	
 	
 	[[nodiscard]] std::unique_ptr<vk::raii::CommandBuffers>
 	Renderer::makeCommandBuffers(
-		vk::CommandBufferLevel const level,
+		vk::raii::CommandPool  const &commandPool,
+		vk::CommandBufferLevel const  level,
 		u32                    const bufferCount
 	)
 	{
@@ -647,7 +803,7 @@ namespace gfx {
 		return std::make_unique<vk::raii::CommandBuffers>(
 			*mpDevice,
 			vk::CommandBufferAllocateInfo {
-				.commandPool        = **mpGraphicsCommandPool,
+				.commandPool        = *commandPool,
 				.level              =   level,
 				.commandBufferCount =   bufferCount
 			}
@@ -699,7 +855,7 @@ namespace gfx {
 		if ( mSurfaceCapabilities.currentExtent.height == max<u32> ) // TODO: unlikely? likely?
 			result = mSurfaceCapabilities.currentExtent;
 		else {
-			auto [width, height] = mpWindow->getWindowDimensions();
+			auto [width, height] = mpWindow->getFramebufferDimensions(); // NOTE: in pixels, unlike the window size
 			result.width =
 				std::clamp(
 					static_cast<u32>(width),
@@ -734,8 +890,8 @@ namespace gfx {
 		auto const  fallbackPresentMode   { vk::PresentModeKHR::eFifo };
 		auto const  availablePresentModes { mpPhysicalDevice->getSurfacePresentModesKHR(*windowSurface) };
 		auto const  idealPresentMode {
-			[/*gPresentationPriority*/] {
-				switch ( kPresentationPriority ) {
+			[this] {
+				switch ( mConfig.presentationPriority ) {
 					case PresentationPriority::eMinimalLatency          : return vk::PresentModeKHR::eMailbox;
 					case PresentationPriority::eMinimalStuttering       : return vk::PresentModeKHR::eFifoRelaxed;
 					case PresentationPriority::eMinimalPowerConsumption : return vk::PresentModeKHR::eFifo;
@@ -770,7 +926,7 @@ namespace gfx {
 		//   shouldn't be ??? unless the function is called in the wrong order:
 //		assert( mSurfaceCapabilities != ??? );
 		
-		auto const idealFramebufferCount { static_cast<u32>( kFramebufferingPriority ) };
+		auto const idealFramebufferCount { static_cast<u32>( mConfig.framebufferingPriority ) };
 		spdlog::info( "... ideal framebuffer count: {}", idealFramebufferCount );
 		auto const minimumFramebufferCount { mSurfaceCapabilities.minImageCount };
 		auto const maximumFramebufferCount {
@@ -791,7 +947,30 @@ namespace gfx {
 	
 	
 	void
-	Renderer::makeSwapchain()
+	Renderer::selectDepthFormat()
+	{
+		spdlog::info( "Selecting a depth format..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpPhysicalDevice != nullptr );
+		
+		// NOTE: the stencil aspect is unused, so depth-only formats are preferred; `eD16Unorm` support is mandatory
+		for ( auto const candidate: kDepthFormatCandidates ) {
+			auto const properties { mpPhysicalDevice->getFormatProperties( candidate ) };
+			if ( properties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eDepthStencilAttachment ) {
+				spdlog::info( "... using `{}`", to_string( candidate ) );
+				mDepthFormat = candidate;
+				return;
+			}
+		}
+		throw std::runtime_error { "Unable to find a supported depth format!" };
+	} // end-of-function: Renderer::selectDepthFormat
+	
+	
+	
+	void
+	Renderer::makeSwapchain( vk::SwapchainKHR const oldSwapchain )
 	{
 		spdlog::info( "Making a swapchain..." );
 		
@@ -829,13 +1008,72 @@ namespace gfx {
 				.compositeAlpha        =  vk::CompositeAlphaFlagBitsKHR::eOpaque,
 				.presentMode           =  mPresentMode,
 				.clipped               =  VK_TRUE,
-				.oldSwapchain          =  VK_NULL_HANDLE // TODO: revisit later after implementing resizing
+				.oldSwapchain          =  oldSwapchain // null unless remaking (see: generateDynamicState)
 			}
 		);
 		
-		// Image views: TODO(refactor)
-		spdlog::info( "Creating swapchain framebuffer image view(s)..." );
 		mImages = mpSwapchain->getImages();
+		makeImageViews();
+	} // end-of-function: Renderer::makeSwapchain
+	
+	
+	
+	void
+	Renderer::makeOffscreenImages()
+	{
+		spdlog::info( "Making offscreen color image(s)..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpDevice    != nullptr );
+		assert( mpAllocator != nullptr );
+		//   should be empty unless the function has been called multiple times (which it shouldn't):
+		assert( mOffscreenImages.empty() );
+		assert( isHeadless() );
+		
+		// NOTE: one image per frame slot; so an image is free for reuse once its slot's previous frame has completed
+		mSurfaceFormat    = { .format = kHeadlessColorFormat, .colorSpace = vk::ColorSpaceKHR::eSrgbNonlinear };
+		mSurfaceExtent    = mHeadlessExtent;
+		mFramebufferCount = RendererConfig::kMaxFramesInFlight; // i.e. enough for any config
+		spdlog::info( "... {} image(s) of {}x{}", mFramebufferCount, mSurfaceExtent.width, mSurfaceExtent.height );
+		
+		mOffscreenImages.reserve( mFramebufferCount );
+		for ( u32 index{0}; index < mFramebufferCount; ++index ) {
+			auto imageHandle {
+				vk::raii::Image(
+					*mpDevice,
+					vk::ImageCreateInfo {
+						.imageType     = vk::ImageType::e2D,
+						.format        = mSurfaceFormat.format,
+						.extent        = vk::Extent3D { .width = mSurfaceExtent.width, .height = mSurfaceExtent.height, .depth = 1 },
+						.mipLevels     = 1,
+						.arrayLayers   = 1,
+						.samples       = vk::SampleCountFlagBits::e1,
+						.tiling        = vk::ImageTiling::eOptimal,
+						.usage         = vk::ImageUsageFlagBits::eColorAttachment
+						               | vk::ImageUsageFlagBits::eTransferSrc, // for readbacks
+						.sharingMode   = vk::SharingMode::eExclusive,
+						.initialLayout = vk::ImageLayout::eUndefined
+					}
+				)
+			};
+			auto imageAllocation { mpAllocator->allocate( imageHandle, vk::MemoryPropertyFlagBits::eDeviceLocal ) };
+			mOffscreenImages.push_back( Image { std::move(imageAllocation), std::move(imageHandle) } );
+			mImages.push_back( static_cast<VkImage>( *mOffscreenImages.back().handle ) );
+		}
+		makeImageViews();
+	} // end-of-function: Renderer::makeOffscreenImages
+	
+	
+	
+	void
+	Renderer::makeImageViews()
+	{
+		spdlog::info( "Creating framebuffer image view(s)..." );
+		
+		// pre-condition(s):
+		assert( mImageViews.empty() );
+		
 		mImageViews.reserve( mImages.size() );
 		for ( auto const &image: mImages ) {
 			mImageViews.emplace_back(
@@ -853,13 +1091,83 @@ namespace gfx {
 					                  }
 				}
 			);
-		}	
-	} // end-of-function: Renderer::makeSwapchain
+		}
+	} // end-of-function: Renderer::makeImageViews
+	
+	
+	
+	void
+	Renderer::makeDepthImages()
+	{
+		spdlog::info( "Making depth image(s)..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpDevice    != nullptr );
+		assert( mpAllocator != nullptr );
+		//   should be empty unless the previous ones haven't been retired:
+		assert( mDepthImages.empty()     );
+		assert( mDepthImageViews.empty() );
+		
+		// NOTE: Depth is cleared on load and never stored by the render pass, so it only has to outlive the frame
+		//       that renders into it; one image per frame slot (rather than per swapchain image) is enough for that.
+		//       Since it never leaves tile memory on tilers, lazily allocated memory is used when available.
+		auto const lazyMemoryProperties {
+			vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eLazilyAllocated
+		};
+		bool isLazy { false };
+		mDepthImages.reserve(     RendererConfig::kMaxFramesInFlight );
+		mDepthImageViews.reserve( RendererConfig::kMaxFramesInFlight );
+		for ( u32 slot{0}; slot < RendererConfig::kMaxFramesInFlight; ++slot ) {
+			auto imageHandle {
+				vk::raii::Image(
+					*mpDevice,
+					vk::ImageCreateInfo {
+						.imageType     = vk::ImageType::e2D,
+						.format        = mDepthFormat,
+						.extent        = vk::Extent3D { .width = mSurfaceExtent.width, .height = mSurfaceExtent.height, .depth = 1 },
+						.mipLevels     = 1,
+						.arrayLayers   = 1,
+						.samples       = vk::SampleCountFlagBits::e1,
+						.tiling        = vk::ImageTiling::eOptimal,
+						.usage         = vk::ImageUsageFlagBits::eDepthStencilAttachment
+						               | vk::ImageUsageFlagBits::eTransientAttachment,
+						.sharingMode   = vk::SharingMode::eExclusive,
+						.initialLayout = vk::ImageLayout::eUndefined
+					}
+				)
+			};
+			isLazy = mpAllocator->hasMemoryType( imageHandle.getMemoryRequirements().memoryTypeBits, lazyMemoryProperties );
+			auto imageAllocation {
+				mpAllocator->allocate( imageHandle, isLazy ? lazyMemoryProperties : vk::MemoryPropertyFlagBits::eDeviceLocal )
+			};
+			mDepthImageViews.emplace_back(
+				*mpDevice,
+				vk::ImageViewCreateInfo {
+					.image            = *imageHandle,
+					.viewType         =  vk::ImageViewType::e2D,
+					.format           =  mDepthFormat,
+					.subresourceRange =  vk::ImageSubresourceRange {
+					                        .aspectMask     = vk::ImageAspectFlagBits::eDepth,
+					                        .baseMipLevel   = 0,
+					                        .levelCount     = 1,
+					                        .baseArrayLayer = 0,
+					                        .layerCount     = 1
+					                     }
+				}
+			);
+			mDepthImages.push_back( Image { std::move(imageAllocation), std::move(imageHandle) } );
+		}
+		spdlog::info(
+			"... {} image(s) of {}x{} in {} memory",
+			mDepthImages.size(), mSurfaceExtent.width, mSurfaceExtent.height, isLazy ? "lazily allocated" : "device local"
+		);
+	} // end-of-function: Renderer::makeDepthImages
 	
 	
 	
 	[[nodiscard]] std::unique_ptr<vk::raii::ShaderModule>
-	Renderer::makeShaderModuleFromBinary( std::vector<char> const &shaderBinary ) const
+	Renderer::makeShaderModuleFromBinary( std::span<std::byte const> shaderBinary ) const
 	{
 		spdlog::info( "Creating a shader module from shader SPIR-V bytecode..." );
 		
@@ -879,17 +1187,21 @@ namespace gfx {
 	
 	
 	[[nodiscard]] std::unique_ptr<vk::raii::ShaderModule>
-	Renderer::makeShaderModuleFromFile( std::string const &shaderSpirvBytecodeFilename ) const
+	Renderer::makeShaderModuleFromAsset( std::string_view const assetName ) const
 	{
-		spdlog::info( "Creating a shader module from shader SPIR-V bytecode file..." );
+		spdlog::info( "Creating a shader module from shader SPIR-V bytecode asset `{}`...", assetName );
 		try {
-			return makeShaderModuleFromBinary( loadBinaryFromFile( shaderSpirvBytecodeFilename ) );
+			// NOTE: straight from the mapping if packed (the asset alignment satisfies SPIR-V's 4 byte alignment)
+			if ( mpAssetPackage != nullptr ) [[likely]]
+				return makeShaderModuleFromBinary( mpAssetPackage->get( assetName ) );
+			auto const shaderBinary { loadBinaryFromFile( fmt::format( "{}{}", kAssetDirectory, assetName ) ) };
+			return makeShaderModuleFromBinary( std::as_bytes( std::span { shaderBinary } ) );
 		}
 		catch( std::runtime_error const &e ) {
-			spdlog::error( "Failed to load shader binary from file! Check path and/or re-compile shaders." );
+			spdlog::error( "Failed to load shader binary! Check path and/or re-compile shaders (and re-pack assets)." );
 			throw e;
 		}
-	} // end-of-function: Renderer::makeShaderModuleFromFile
+	} // end-of-function: Renderer::makeShaderModuleFromAsset
 	
 	
 	
@@ -902,19 +1214,100 @@ namespace gfx {
 		//   shouldn't be null unless the function is called in the wrong order:
 		assert( mpDevice != nullptr );
 		
+		// NOTE: Both bindings are dynamic uniform buffers into the uniform ring, so a single descriptor set
+		//       serves every draw; the camera and object data are selected with dynamic offsets when binding.
+		std::array const descriptorSetLayoutBindings {
+			vk::DescriptorSetLayoutBinding { // camera (see: CameraUniforms)
+				.binding            = 0,
+				.descriptorType     = vk::DescriptorType::eUniformBufferDynamic,
+				.descriptorCount    = 1,
+				.stageFlags         = vk::ShaderStageFlagBits::eVertex,
+				.pImmutableSamplers = nullptr
+			},
+			vk::DescriptorSetLayoutBinding { // object (see: ObjectUniforms)
+				.binding            = 1,
+				.descriptorType     = vk::DescriptorType::eUniformBufferDynamic,
+				.descriptorCount    = 1,
+				.stageFlags         = vk::ShaderStageFlagBits::eVertex,
+				.pImmutableSamplers = nullptr
+			}
+		};
+		mpDescriptorSetLayout = std::make_unique<vk::raii::DescriptorSetLayout>(
+			*mpDevice,
+			vk::DescriptorSetLayoutCreateInfo {
+				.bindingCount = static_cast<u32>( descriptorSetLayoutBindings.size() ),
+				.pBindings    = descriptorSetLayoutBindings.data()
+			}
+		);
+		
+		// NOTE: Textures live in a set of their own (one per texture; see: Texture::getDescriptorSet), so switching
+		//       textures between draws doesn't disturb the uniform ring's set (nor its dynamic offsets).
+		vk::DescriptorSetLayoutBinding const textureSetLayoutBinding { // albedo (see: Texture)
+			.binding            = 0,
+			.descriptorType     = vk::DescriptorType::eCombinedImageSampler,
+			.descriptorCount    = 1,
+			.stageFlags         = vk::ShaderStageFlagBits::eFragment,
+			.pImmutableSamplers = nullptr
+		};
+		mpTextureSetLayout = std::make_unique<vk::raii::DescriptorSetLayout>(
+			*mpDevice,
+			vk::DescriptorSetLayoutCreateInfo {
+				.bindingCount =  1,
+				.pBindings    = &textureSetLayoutBinding
+			}
+		);
+		
+		std::array const setLayouts { **mpDescriptorSetLayout, **mpTextureSetLayout }; // i.e. sets 0 and 1
 		mpGraphicsPipelineLayout = std::make_unique<vk::raii::PipelineLayout>(
 			*mpDevice,
 			vk::PipelineLayoutCreateInfo {
-				.setLayoutCount         = 0,       // TODO: explain
-				.pSetLayouts            = nullptr, // TODO: explain
-				.pushConstantRangeCount = 0,       // TODO: explain
-				.pPushConstantRanges    = nullptr  // TODO: explain
+				.setLayoutCount         = static_cast<u32>( setLayouts.size() ),
+				.pSetLayouts            = setLayouts.data(),
+				.pushConstantRangeCount =   0,       // TODO: explain
+				.pPushConstantRanges    =   nullptr  // TODO: explain
 			}
 		);
 	} // end-of-function: Renderer::makeGraphicsPipelineLayout
 	
 	
 	
+	void
+	Renderer::makeUniformRing( vk::DeviceSize const regionSize )
+	{
+		spdlog::info( "Creating uniform ring buffer..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpDevice              != nullptr );
+		assert( mpAllocator           != nullptr );
+		assert( mpDescriptorSetLayout != nullptr );
+		
+		auto const alignment         { mpPhysicalDevice->getProperties().limits.minUniformBufferOffsetAlignment };
+		auto const alignedRegionSize { (regionSize + alignment - 1) / alignment * alignment };
+		std::array const bindingRanges {
+			vk::DeviceSize { sizeof(CameraUniforms) },
+			vk::DeviceSize { sizeof(ObjectUniforms) }
+		};
+		
+		if ( mpUniformRing != nullptr ) [[unlikely]]
+			retire( std::move( mpUniformRing ) ); // NOTE: the frames in flight might still read from it
+		mpUniformRing = std::make_unique<UniformRing>(
+			*mpDevice,
+			makeBuffer(
+				vk::BufferUsageFlagBits::eUniformBuffer,
+				alignedRegionSize * RendererConfig::kMaxFramesInFlight,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+			),
+			*mpDescriptorSetLayout,
+			bindingRanges,
+			alignedRegionSize,
+			RendererConfig::kMaxFramesInFlight,
+			alignment
+		);
+	} // end-of-function: Renderer::makeUniformRing
+	
+	
+	
 	void
 	Renderer::makeRenderPass()
 	{
@@ -925,35 +1318,86 @@ namespace gfx {
 		assert( mpDevice       != nullptr );
 //		assert( mSurfaceFormat != ???     );
 		
-		vk::AttachmentDescription const colorAttachmentDesc {
-			.format         = mSurfaceFormat.format,
-			.samples        = vk::SampleCountFlagBits::e1,      // no MSAA yet
-			.loadOp         = vk::AttachmentLoadOp::eClear,
-			.storeOp        = vk::AttachmentStoreOp::eStore,
-			.stencilLoadOp  = vk::AttachmentLoadOp::eDontCare,  // no depth/stencil yet
-			.stencilStoreOp = vk::AttachmentStoreOp::eDontCare, // no depth/stencil yet
-			.initialLayout  = vk::ImageLayout::eUndefined,
-			.finalLayout    = vk::ImageLayout::ePresentSrcKHR
+		std::array const attachmentDescs {
+			vk::AttachmentDescription { // color
+				.format         = mSurfaceFormat.format,
+				.samples        = vk::SampleCountFlagBits::e1,      // no MSAA yet
+				.loadOp         = vk::AttachmentLoadOp::eClear,
+				.storeOp        = vk::AttachmentStoreOp::eStore,
+				.stencilLoadOp  = vk::AttachmentLoadOp::eDontCare,  // not a depth/stencil attachment
+				.stencilStoreOp = vk::AttachmentStoreOp::eDontCare, // not a depth/stencil attachment
+				.initialLayout  = vk::ImageLayout::eUndefined,
+				.finalLayout    = isHeadless() ? vk::ImageLayout::eTransferSrcOptimal // for readbacks
+				                               : vk::ImageLayout::ePresentSrcKHR
+			},
+			// NOTE: The previous contents are never loaded (a clear is a free on-tile initialization) and the
+			//       results are never stored, so tilers never have to move depth to or from memory.
+			vk::AttachmentDescription { // depth
+				.format         = mDepthFormat,
+				.samples        = vk::SampleCountFlagBits::e1,
+				.loadOp         = vk::AttachmentLoadOp::eClear,
+				.storeOp        = vk::AttachmentStoreOp::eDontCare,
+				.stencilLoadOp  = vk::AttachmentLoadOp::eDontCare,  // stencil is unused
+				.stencilStoreOp = vk::AttachmentStoreOp::eDontCare, // stencil is unused
+				.initialLayout  = vk::ImageLayout::eUndefined,
+				.finalLayout    = vk::ImageLayout::eDepthStencilAttachmentOptimal
+			}
 		};
 		
 		vk::AttachmentReference const colorAttachmentRef {
-			.attachment = 0, // index 0; we only have one attachment at the moment
+			.attachment = 0,
 			.layout     = vk::ImageLayout::eColorAttachmentOptimal
 		};
 		
+		vk::AttachmentReference const depthAttachmentRef {
+			.attachment = 1,
+			.layout     = vk::ImageLayout::eDepthStencilAttachmentOptimal
+		};
+		
 		vk::SubpassDescription const colorSubpassDesc {
-			.pipelineBindPoint    =  vk::PipelineBindPoint::eGraphics,
-			.colorAttachmentCount =  1,
-			.pColorAttachments    = &colorAttachmentRef
+			.pipelineBindPoint       =  vk::PipelineBindPoint::eGraphics,
+			.colorAttachmentCount    =  1,
+			.pColorAttachments       = &colorAttachmentRef,
+			.pDepthStencilAttachment = &depthAttachmentRef
+		};
+		
+		std::array const dependencies {
+			// NOTE: A frame slot's depth image is reused by the slot's next frame; the render pass' clear (and the
+			//       layout transitions) must wait for the previous frame's depth tests and color writes to finish.
+			vk::SubpassDependency {
+				.srcSubpass    = VK_SUBPASS_EXTERNAL,
+				.dstSubpass    = 0,
+				.srcStageMask  = vk::PipelineStageFlagBits::eColorAttachmentOutput
+				               | vk::PipelineStageFlagBits::eLateFragmentTests,
+				.dstStageMask  = vk::PipelineStageFlagBits::eColorAttachmentOutput
+				               | vk::PipelineStageFlagBits::eEarlyFragmentTests,
+				.srcAccessMask = vk::AccessFlagBits::eDepthStencilAttachmentWrite,
+				.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite
+				               | vk::AccessFlagBits::eDepthStencilAttachmentRead
+				               | vk::AccessFlagBits::eDepthStencilAttachmentWrite
+			},
+			// NOTE: Headless only; orders the color writes and the final layout transition (into eTransferSrcOptimal)
+			//       before the readback's copy (see: `recordReadback`). The implicit dependency on EXTERNAL only
+			//       reaches the bottom of the pipe, which doesn't order anything against later commands.
+			vk::SubpassDependency {
+				.srcSubpass    = 0,
+				.dstSubpass    = VK_SUBPASS_EXTERNAL,
+				.srcStageMask  = vk::PipelineStageFlagBits::eColorAttachmentOutput,
+				.dstStageMask  = vk::PipelineStageFlagBits::eTransfer,
+				.srcAccessMask = vk::AccessFlagBits::eColorAttachmentWrite,
+				.dstAccessMask = vk::AccessFlagBits::eTransferRead
+			}
 		};
 		
 		mpRenderPass = std::make_unique<vk::raii::RenderPass>(
 			*mpDevice,
 			vk::RenderPassCreateInfo {
-				.attachmentCount =  1,
-				.pAttachments    = &colorAttachmentDesc,
+				.attachmentCount =  static_cast<u32>( attachmentDescs.size() ),
+				.pAttachments    =  attachmentDescs.data(),
 				.subpassCount    =  1,
-				.pSubpasses      = &colorSubpassDesc
+				.pSubpasses      = &colorSubpassDesc,
+				.dependencyCount =  isHeadless() ? 2u : 1u,
+				.pDependencies   =  dependencies.data()
 			}
 		);
 	} // end-of-function: Renderer::makeRenderPass
@@ -971,21 +1415,27 @@ namespace gfx {
 		//   shouldn't be null or ??? unless the function is called in the wrong order:
 		assert( mpDevice       != nullptr );
 		
-		spdlog::info( "Creating shader modules..." );
-		auto const vertexModule   = makeShaderModuleFromFile( "../dat/shaders/test1.vert.spv" );
-		auto const fragmentModule = makeShaderModuleFromFile( "../dat/shaders/test1.frag.spv" );	
+		assert( mpGraphicsPipelineLayout != nullptr );
+		assert( mpRenderPass             != nullptr );
+		
+		// NOTE: shader modules are only loaded once and kept around for later pipeline rebuilds
+		if ( mpVertexShaderModule == nullptr or mpFragmentShaderModule == nullptr ) [[unlikely]] {
+			spdlog::info( "Creating shader modules..." );
+			mpVertexShaderModule   = makeShaderModuleFromAsset( "shaders/test1.vert.spv" );
+			mpFragmentShaderModule = makeShaderModuleFromAsset( "shaders/test1.frag.spv" );
+		}
 		
 		spdlog::info( "Creating pipeline shader stages..." );
 		vk::PipelineShaderStageCreateInfo const shaderStageCreateInfo[] {
 			{
 				.stage  =   vk::ShaderStageFlagBits::eVertex,
-				.module = **vertexModule,
+				.module = **mpVertexShaderModule,
 				.pName  =   "main" // shader program entry point
 			// .pSpecializationInfo is unused (for now); but it allows for setting shader constants
 			},
 			{
 				.stage  =   vk::ShaderStageFlagBits::eFragment,
-				.module = **fragmentModule,
+				.module = **mpFragmentShaderModule,
 				.pName  =   "main" // shader program entry point
 			// .pSpecializationInfo is unused (for now); but it allows for setting shader constants
 			}
@@ -1006,25 +1456,13 @@ namespace gfx {
 			.primitiveRestartEnable = VK_FALSE // unused (for now); allows designating strip gap indices
 		};
 		
-		vk::Viewport const viewport {
-			.x        = 0.0f,
-			.y        = 0.0f,
-			.width    = static_cast<f32>( mSurfaceExtent.width  ),
-			.height   = static_cast<f32>( mSurfaceExtent.height ),
-			.minDepth = 0.0f,
-			.maxDepth = 1.0f
-		};
-		
-		vk::Rect2D const scissor {
-			.offset = { 0, 0 },
-			.extent = mSurfaceExtent
-		};
-		
+		// NOTE: the viewport and scissor are dynamic state (set when recording), so that the
+		//       pipeline doesn't depend on the surface extent and survives swapchain recreation
 		vk::PipelineViewportStateCreateInfo const viewportStateCreateInfo {
-			.viewportCount =  1,
-			.pViewports    = &viewport,
-			.scissorCount  =  1,
-			.pScissors     = &scissor,
+			.viewportCount = 1,
+			.pViewports    = nullptr, // dynamic
+			.scissorCount  = 1,
+			.pScissors     = nullptr, // dynamic
 		};
 		
 		vk::PipelineRasterizationStateCreateInfo const rasterizationStateCreateInfo {
@@ -1049,9 +1487,14 @@ namespace gfx {
 			.alphaToOneEnable      = VK_FALSE 
 		}; // TODO: revisit later
 		
-		// vk::PipelineDepthStencilStateCreateInfo const depthStencilStateCreateInfo {
-		// 	// TODO: unused for now; revisit later
-		// };
+		// NOTE: less-or-equal keeps the painter's order of draws at equal depth (e.g. the 2D geometry)
+		vk::PipelineDepthStencilStateCreateInfo const depthStencilStateCreateInfo {
+			.depthTestEnable       = VK_TRUE,
+			.depthWriteEnable      = VK_TRUE,
+			.depthCompareOp        = vk::CompareOp::eLessOrEqual,
+			.depthBoundsTestEnable = VK_FALSE,
+			.stencilTestEnable     = VK_FALSE
+		};
 		
 		vk::PipelineColorBlendAttachmentState const colorBlendAttachmentState {
 			.blendEnable         = VK_FALSE,
@@ -1076,23 +1519,32 @@ namespace gfx {
 			.blendConstants    =  std::array<f32,4>{ 0.0f, 0.0f, 0.0f, 0.0f }
 		};
 		
-		// e.g: std::array<vk::DynamicState> const dynamic_states {
-		//         vk::DynamicState::eLineWidth	
-		//      };
-		// 
-		// vk::PipelineDynamicStateCreateInfo const
-		// dynamic_state_create_info
-		// { // NOTE: unused (for now)
-		// 	.dynamicStateCount = 0,
-		// 	.pDynamicStates    = nullptr
-		// };
+		std::array constexpr dynamicStates {
+			vk::DynamicState::eViewport,
+			vk::DynamicState::eScissor
+		};
 		
-		makeGraphicsPipelineLayout();
-		makeRenderPass();
+		vk::PipelineDynamicStateCreateInfo const dynamicStateCreateInfo {
+			.dynamicStateCount = static_cast<u32>( dynamicStates.size() ),
+			.pDynamicStates    = dynamicStates.data()
+		};
+		
+		// NOTE: creation feedback reports whether the driver found the pipeline in the pipeline cache
+		vk::PipelineCreationFeedbackEXT               pipelineFeedback {};
+		std::array<vk::PipelineCreationFeedbackEXT,2> stageFeedbacks   {};
+		vk::PipelineCreationFeedbackCreateInfoEXT const feedbackCreateInfo {
+			.pPipelineCreationFeedback          = &pipelineFeedback,
+			.pipelineStageCreationFeedbackCount =  static_cast<u32>( stageFeedbacks.size() ),
+			.pPipelineStageCreationFeedbacks    =  stageFeedbacks.data()
+		};
+		bool const hasCreationFeedback { isDeviceExtensionEnabled( VK_EXT_PIPELINE_CREATION_FEEDBACK_EXTENSION_NAME ) };
+		
+		auto const startTime { std::chrono::steady_clock::now() };
 		mpGraphicsPipeline = std::make_unique<vk::raii::Pipeline>(
 			*mpDevice,
-			nullptr,
+			*mpPipelineCache,
 			vk::GraphicsPipelineCreateInfo {
+				.pNext               =   hasCreationFeedback ? &feedbackCreateInfo : nullptr,
 				.stageCount          =   2,
 				.pStages             =   shaderStageCreateInfo,
 				.pVertexInputState   =  &vertexInputStateCreateInfo,
@@ -1100,9 +1552,9 @@ namespace gfx {
 				.pViewportState      =  &viewportStateCreateInfo,
 				.pRasterizationState =  &rasterizationStateCreateInfo,
 				.pMultisampleState   =  &multisampleStateCreateInfo,
-				.pDepthStencilState  =   nullptr, // unused for now
+				.pDepthStencilState  =  &depthStencilStateCreateInfo,
 				.pColorBlendState    =  &colorBlendStateCreateInfo,
-				.pDynamicState       =   nullptr, // unused for now
+				.pDynamicState       =  &dynamicStateCreateInfo,
 				.layout              = **mpGraphicsPipelineLayout,
 				.renderPass          = **mpRenderPass,
 				.subpass             =   0,
@@ -1110,10 +1562,117 @@ namespace gfx {
 				.basePipelineIndex   =   -1,
 			}
 		);
+		std::chrono::duration<f64, std::milli> const duration { std::chrono::steady_clock::now() - startTime };
+		
+		++mPipelineCreationCount;
+		if ( hasCreationFeedback and (pipelineFeedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eValid) ) [[likely]] {
+			bool const isCacheHit {
+				pipelineFeedback.flags & vk::PipelineCreationFeedbackFlagBitsEXT::eApplicationPipelineCacheHit
+			};
+			if ( isCacheHit )
+				++mPipelineCacheHitCount;
+			spdlog::info( "... created graphics pipeline in {:.3f} ms (pipeline cache {})", duration.count(), isCacheHit ? "hit" : "miss" );
+		}
+		else [[unlikely]] {
+			spdlog::info( "... created graphics pipeline in {:.3f} ms (pipeline cache hit unknown)", duration.count() );
+		}
 	} // end-of-function: Renderer::makeGraphicsPipeline
 	
 	
 	
+	[[nodiscard]] bool
+	Renderer::isDeviceExtensionEnabled( char const *extensionName ) const
+	{
+		return std::ranges::any_of(
+			mDeviceExtensions,
+			[extensionName]( char const *enabled ) { return std::strcmp( enabled, extensionName ) == 0; }
+		);
+	} // end-of-function: Renderer::isDeviceExtensionEnabled
+	
+	
+	
+	void
+	Renderer::openAssetPackage()
+	{
+		spdlog::info( "Opening the asset package `{}`...", kAssetPackageFilename );
+		if ( not std::filesystem::exists( kAssetPackageFilename ) ) {
+			spdlog::info( "... there's none; loading assets per file from `{}`", kAssetDirectory );
+			return;
+		}
+		mpAssetPackage = std::make_unique<AssetPackage>( kAssetPackageFilename );
+		spdlog::info( "... mapped {} asset(s)", mpAssetPackage->getAssetCount() );
+	} // end-of-function: Renderer::openAssetPackage
+	
+	
+	
+	void
+	Renderer::makePipelineCache()
+	{
+		spdlog::info( "Creating a pipeline cache..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpPhysicalDevice != nullptr );
+		assert( mpDevice         != nullptr );
+		//   should be null unless the function has been called multiple times (which it shouldn't):
+		assert( mpPipelineCache  == nullptr );
+		
+		std::vector<char> cacheData {};
+		if ( std::ifstream cacheFile{ kPipelineCacheFilename, std::ios::binary | std::ios::ate } ) {
+			auto const cacheSize { cacheFile.tellg() };
+			cacheData.resize( static_cast<std::size_t>(cacheSize) );
+			cacheFile.seekg( 0 );
+			cacheFile.read( cacheData.data(), cacheSize );
+			if ( not cacheFile or not isPipelineCacheCompatible( cacheData, mpPhysicalDevice->getProperties() ) ) [[unlikely]] {
+				spdlog::warn( "... discarding invalid or incompatible pipeline cache file `{}`", kPipelineCacheFilename );
+				cacheData.clear();
+			}
+			else [[likely]]
+				spdlog::info( "... loaded {} bytes from pipeline cache file `{}`", cacheData.size(), kPipelineCacheFilename );
+		}
+		else {
+			spdlog::info( "... no pipeline cache file found; starting with an empty cache" );
+		}
+		
+		mpPipelineCache = std::make_unique<vk::raii::PipelineCache>(
+			*mpDevice,
+			vk::PipelineCacheCreateInfo {
+				.initialDataSize = cacheData.size(),
+				.pInitialData    = cacheData.empty() ? nullptr : cacheData.data()
+			}
+		);
+	} // end-of-function: Renderer::makePipelineCache
+	
+	
+	
+	void
+	Renderer::savePipelineCache() const
+	{
+		spdlog::info( "Saving the pipeline cache..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpPipelineCache != nullptr );
+		
+		if ( mPipelineCreationCount > 0 ) [[likely]]
+			spdlog::info( "... pipeline cache hit rate: {}/{}", mPipelineCacheHitCount, mPipelineCreationCount );
+		
+		auto const cacheData { mpPipelineCache->getData() };
+		// NOTE: written to a temporary file first and then renamed, so a crash never leaves a truncated cache behind
+		std::filesystem::path const cachePath     { kPipelineCacheFilename };
+		std::filesystem::path const temporaryPath { cachePath.string() + ".tmp" };
+		{
+			std::ofstream cacheFile { temporaryPath, std::ios::binary | std::ios::trunc };
+			cacheFile.write( reinterpret_cast<char const *>( cacheData.data() ), static_cast<std::streamsize>( cacheData.size() ) );
+			if ( not cacheFile ) [[unlikely]]
+				throw std::runtime_error { "Failed to write pipeline cache file!" };
+		}
+		std::filesystem::rename( temporaryPath, cachePath );
+		spdlog::info( "... wrote {} bytes to pipeline cache file `{}`", cacheData.size(), kPipelineCacheFilename );
+	} // end-of-function: Renderer::savePipelineCache
+	
+	
+	
 	void
 	Renderer::makeFramebuffers()
 	{
@@ -1124,24 +1683,38 @@ namespace gfx {
 		assert( mpDevice     != nullptr );
 		assert( mpRenderPass != nullptr );
 			
-		mFramebuffers.reserve( mFramebufferCount );
+		assert( mDepthImageViews.size() == RendererConfig::kMaxFramesInFlight );
+		
+		// NOTE: one per (image, frame slot) pair since the depth image is per frame slot (see: getFramebufferIndex)
+		mFramebuffers.reserve( mImageViews.size() * RendererConfig::kMaxFramesInFlight );
 		for ( auto const &imageView: mImageViews ) {
-			mFramebuffers.emplace_back(
-				*mpDevice,
-				vk::FramebufferCreateInfo {
-					.renderPass      = **mpRenderPass,
-					.attachmentCount =   1, // only color for now
-					.pAttachments    = &*imageView,
-					.width           =   mSurfaceExtent.width,
-					.height          =   mSurfaceExtent.height,
-					.layers          =   1 // TODO: explain
-				}
-			);
+			for ( auto const &depthImageView: mDepthImageViews ) {
+				std::array const attachments { *imageView, *depthImageView };
+				mFramebuffers.emplace_back(
+					*mpDevice,
+					vk::FramebufferCreateInfo {
+						.renderPass      = **mpRenderPass,
+						.attachmentCount =   static_cast<u32>( attachments.size() ),
+						.pAttachments    =   attachments.data(),
+						.width           =   mSurfaceExtent.width,
+						.height          =   mSurfaceExtent.height,
+						.layers          =   1 // TODO: explain
+					}
+				);
+			}
 		}
 	} // end-of-function: Renderer::makeFramebuffers	
 	
 	
 	
+	[[nodiscard]] u32
+	Renderer::getFramebufferIndex( u32 const imageIndex, u32 const frameSlot ) const noexcept
+	{
+		return imageIndex * RendererConfig::kMaxFramesInFlight + frameSlot;
+	} // end-of-function: Renderer::getFramebufferIndex
+	
+	
+	
 	[[nodiscard]] std::unique_ptr<Buffer>
 	Renderer::makeBuffer(
 		vk::BufferUsageFlags    const usage,
@@ -1153,305 +1726,748 @@ namespace gfx {
 		
 		// pre-condition(s):
 		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpDevice != nullptr );
-		
-		u32 const queueFamilyIndices[] {
-			mQueueFamilyIndices.graphicsIndex,
-			mQueueFamilyIndices.transferIndex
-		};
+		assert( mpDevice    != nullptr );
+		assert( mpAllocator != nullptr );
 		
 		spdlog::info( "... creating buffer handle" );
+		// NOTE: exclusive sharing; uploads explicitly hand ownership over to the graphics queue family
 		auto bufferHandle {
 			vk::raii::Buffer(
 				*mpDevice,
 				vk::BufferCreateInfo {
-					.size                  = size,
-					.usage                 = usage,
-					.sharingMode           = vk::SharingMode::eConcurrent,
-					.queueFamilyIndexCount = 2,
-					.pQueueFamilyIndices   = queueFamilyIndices
+					.size        = size,
+					.usage       = usage,
+					.sharingMode = vk::SharingMode::eExclusive
 				}
 			)
 		};
 		
-		auto const requirements { bufferHandle.getMemoryRequirements() };
-		
-		spdlog::info( "... allocating buffer device memory" );
-		auto bufferMemory {
-			vk::raii::DeviceMemory(
-				std::move(
-					mpDevice->allocateMemory(
-						{
-							.allocationSize  = requirements.size,
-							.memoryTypeIndex = findMemoryTypeIndex(
-							                      requirements.memoryTypeBits,
-							                      properties
-							                 )
-						}
-					)
-				)
-			)
-		};
-		
+		spdlog::info( "... sub-allocating and binding buffer device memory" );
+		auto bufferAllocation { mpAllocator->allocate( bufferHandle, properties ) };
 		
-		spdlog::info( "... binding buffer device memory to buffer handle" );
-		bufferHandle.bindMemory( *bufferMemory, 0 );
-   
-		return std::make_unique<Buffer>( std::move(bufferHandle), std::move(bufferMemory) );
+		return std::make_unique<Buffer>( std::move(bufferAllocation), std::move(bufferHandle) );
 	} // end-of-function: Renderer::makeBuffer
 	
 	
 	
-	void
-	Renderer::copy( Buffer const &src, Buffer &dst, vk::DeviceSize const size )
+	UploadTicket
+	Renderer::copy( std::unique_ptr<Buffer> src, Buffer const &dst, vk::DeviceSize const size, vk::DeviceSize const dstOffset )
 	{
-		spdlog::info( "Copying {} bytes of data from one buffer to another...", size );
-		vk::raii::CommandBuffers commandBuffer(
-			*mpDevice,
-			vk::CommandBufferAllocateInfo {
-				.commandPool        = **mpTransferCommandPool,
-				.level              =   vk::CommandBufferLevel::ePrimary,
-				.commandBufferCount =   1
-			}
-		);
-		commandBuffer[0].begin({ .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
-		commandBuffer[0].copyBuffer( *src.handle, *dst.handle, {{.srcOffset=0, .dstOffset=0, .size=size}} );
-		commandBuffer[0].end();
-		vk::SubmitInfo const submitInfo {
-			.commandBufferCount =  1,
-			.pCommandBuffers    = &*commandBuffer[0]
-		};
-		mpTransferQueue->submit({ submitInfo });
-		mpTransferQueue->waitIdle(); // TODO(later): use fence instead if allowing concurrent transfers
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpUploadService != nullptr );
+		
+		spdlog::info( "Enqueuing a copy of {} bytes of data from one buffer to another...", size );
+		auto const ticket { mpUploadService->enqueueCopy( *src->handle, 0, *dst.handle, dstOffset, size ) };
+		mpUploadService->retain( std::move(src) ); // NOTE: kept alive until the batch has completed
+		return ticket;
 	} // end-of-function: Renderer::copy
 	
 	
 	
 	void
-	Renderer::makeVertexBuffer()
+	Renderer::makeStagingRing()
 	{
-		spdlog::info( "Creating vertex buffer..." );
+		spdlog::info( "Creating staging ring buffer..." );
 		
 		// pre-condition(s):
 		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpDevice != nullptr );
-		
-
-		spdlog::info( "... creating staging buffer" );
-		vk::DeviceSize const size { kRectangleVertices.size() * sizeof(Vertex2D) };
-		auto stagingBuffer = makeBuffer(
-			vk::BufferUsageFlagBits::eTransferSrc,
-			size,
-			vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
-		);
-		
-		spdlog::info( "... mapping staging buffer memory to CPU memory" );
-		auto *mappedMemory { stagingBuffer->memory.mapMemory( 0, size ) };
-		
-		spdlog::info( "... copying vertex data to staging buffer's memory" );
-		std::memcpy( mappedMemory, kRectangleVertices.data(), static_cast<std::size_t>(size) );
-		// NOTE: if not using host coherent memory (which we are),
-		// call flushMappedMemoryRanges here and invalidateMappedMemoryRanges before reading it
-		spdlog::info( "... unmapping memory" );
-		stagingBuffer->memory.unmapMemory();
-		
-		spdlog::info( "... creating vertex buffer" );
-		mpVertexBuffer = makeBuffer(
-			vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer,
+		assert( mpDevice      != nullptr );
+		assert( mpAllocator   != nullptr );
+		//   should be null unless the function has been called multiple times (which it shouldn't):
+		assert( mpStagingRing == nullptr );
+		
+		auto const size { vk::DeviceSize { mConfig.stagingRingSizeMiB } * 1024 * 1024 };
+		mpStagingRing = std::make_unique<StagingRing>(
+			makeBuffer(
+				vk::BufferUsageFlagBits::eTransferSrc,
+				size,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+			),
 			size,
-			vk::MemoryPropertyFlagBits::eDeviceLocal
+			RendererConfig::kMaxFramesInFlight
 		);
-		spdlog::info( "... copying data from staging buffer memory to vertex buffer memory" );
-		copy( *stagingBuffer, *mpVertexBuffer, size );
-		spdlog::info( "... done!" );
-	} // end-of-function: Renderer::makeVertexBuffer
+	} // end-of-function: Renderer::makeStagingRing
 	
 	
 	
-	void
-	Renderer::makeIndexBuffer()
+	UploadTicket
+	Renderer::upload( void const *pData, vk::DeviceSize const size, Buffer const &dst, vk::DeviceSize const dstOffset )
 	{
-		spdlog::info( "Creating index buffer..." );
-		
 		// pre-condition(s):
 		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpDevice != nullptr );
+		assert( mpStagingRing   != nullptr );
+		assert( mpUploadService != nullptr );
+		
+		if ( auto const maybeSlice{ mpStagingRing->allocate( size ) } ) [[likely]] {
+			std::memcpy( maybeSlice->pData, pData, static_cast<std::size_t>(size) );
+			// NOTE: if not using host coherent memory (which we are),
+			// call flushMappedMemoryRanges here and invalidateMappedMemoryRanges before reading it
+			return mpUploadService->enqueueCopy( maybeSlice->buffer, maybeSlice->offset, *dst.handle, dstOffset, size );
+		}
+		else [[unlikely]] {
+			// ring is exhausted (or the upload is larger than the ring); fall back on a one-off staging buffer:
+			countStagingFallback( size );
+			auto stagingBuffer = makeBuffer(
+				vk::BufferUsageFlagBits::eTransferSrc,
+				size,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+			);
+			std::memcpy( stagingBuffer->allocation.getMappedData(), pData, static_cast<std::size_t>(size) );
+			return copy( std::move(stagingBuffer), dst, size, dstOffset );
+		}
+	} // end-of-function: Renderer::upload
+	
+	
+	
+	UploadTicket
+	Renderer::uploadImage(
+		std::span<std::byte const>               data,
+		vk::Image                        const   dst,
+		vk::ImageSubresourceRange        const  &subresourceRange,
+		std::vector<vk::BufferImageCopy>         regions,
+		std::optional<MipGeneration>     const   mipGeneration
+	)
+	{
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpStagingRing   != nullptr );
+		assert( mpUploadService != nullptr );
+		
+		// NOTE: the ring's 16 byte alignment satisfies the offset requirements of 1, 2, 4, 8, and 16 byte texel blocks
+		auto const size { static_cast<vk::DeviceSize>( data.size_bytes() ) };
+		std::unique_ptr<Buffer> pStagingBuffer {};
+		vk::Buffer              src            {};
+		vk::DeviceSize          srcOffset      { 0 };
+		if ( auto const maybeSlice{ mpStagingRing->allocate( size ) } ) [[likely]] {
+			std::memcpy( maybeSlice->pData, data.data(), data.size_bytes() );
+			src       = maybeSlice->buffer;
+			srcOffset = maybeSlice->offset;
+		}
+		else [[unlikely]] {
+			// e.g. a large atlas; fall back on a one-off staging buffer rather than stalling on the ring:
+			countStagingFallback( size );
+			pStagingBuffer = makeBuffer(
+				vk::BufferUsageFlagBits::eTransferSrc,
+				size,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+			);
+			std::memcpy( pStagingBuffer->allocation.getMappedData(), data.data(), data.size_bytes() );
+			src = *pStagingBuffer->handle;
+		}
+		for ( auto &region: regions )
+			region.bufferOffset += srcOffset;
 		
-
-		spdlog::info( "... creating staging buffer" );
-		vk::DeviceSize const size { kRectangleIndices.size() * sizeof(u16) };
-		auto stagingBuffer = makeBuffer(
-			vk::BufferUsageFlagBits::eTransferSrc,
-			size,
-			vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
-		);
+		auto const ticket { mpUploadService->enqueueImageCopy( src, dst, subresourceRange, regions, mipGeneration ) };
+		if ( pStagingBuffer != nullptr ) [[unlikely]]
+			mpUploadService->retain( std::move( pStagingBuffer ) ); // NOTE: kept alive until the batch has completed
+		return ticket;
+	} // end-of-function: Renderer::uploadImage
+	
+	
+	
+	void
+	Renderer::makeGeometryBuffer()
+	{
+		spdlog::info( "Creating the geometry buffer..." );
 		
-		spdlog::info( "... mapping staging buffer memory to CPU memory" );
-		auto *mappedMemory { stagingBuffer->memory.mapMemory( 0, size ) };
-	   
-		spdlog::info( "... copying index data to staging buffer's memory" );
-		std::memcpy( mappedMemory, kRectangleIndices.data(), static_cast<std::size_t>(size) );
-		// NOTE: if not using host coherent memory (which we are),
-		// call flushMappedMemoryRanges here and invalidateMappedMemoryRanges before reading it
-		spdlog::info( "... unmapping memory" );
-		stagingBuffer->memory.unmapMemory();
-		
-		spdlog::info( "... creating vertex buffer" );
-		mpIndexBuffer = makeBuffer(
-			vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer,
-			size,
-			vk::MemoryPropertyFlagBits::eDeviceLocal
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpDevice != nullptr );
+		
+		mpGeometryBuffer = std::make_unique<GeometryBuffer>(
+			makeBuffer(
+				vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eVertexBuffer,
+				kGeometryVertexCapacity * sizeof(Vertex2D),
+				vk::MemoryPropertyFlagBits::eDeviceLocal
+			),
+			kGeometryVertexCapacity,
+			makeBuffer(
+				vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer,
+				kGeometryIndexCapacity * sizeof(u32),
+				vk::MemoryPropertyFlagBits::eDeviceLocal
+			),
+			kGeometryIndexCapacity
 		);
-		spdlog::info( "... copying data from staging buffer memory to index buffer memory" );
-		copy( *stagingBuffer, *mpIndexBuffer, size );
+		spdlog::info( "... staging the rectangle mesh for upload" );
+		std::array<u32,kRectangleIndices.size()> rectangleIndices {};
+		std::ranges::copy( kRectangleIndices, rectangleIndices.begin() ); // NOTE: the geometry buffer's indices are 32-bit
+		mRectangleMesh = addMesh( kRectangleVertices, rectangleIndices );
 		spdlog::info( "... done!" );
-	} // end-of-function: Renderer::makeIndexBuffer
+	} // end-of-function: Renderer::makeGeometryBuffer
 	
 	
 	
-	void
-	Renderer::makeCommandBuffers()
+	MeshId
+	Renderer::addMesh( std::span<Vertex2D const> vertices, std::span<u32 const> indices )
 	{
-		spdlog::info( "Creating command buffer(s)..." );
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpGeometryBuffer != nullptr );
 		
+		auto const meshId {
+			vertices.size() <= max<u32> and indices.size() <= max<u32>
+				? mpGeometryBuffer->allocate( static_cast<u32>( vertices.size() ), static_cast<u32>( indices.size() ) )
+				: std::nullopt
+		};
+		if ( not meshId ) [[unlikely]] {
+			throw std::runtime_error {
+				fmt::format(
+					"The geometry buffer is full! ({} vertices and {} indices are in use; {} and {} more were requested)",
+					mpGeometryBuffer->getVertexCount(), mpGeometryBuffer->getIndexCount(), vertices.size(), indices.size()
+				)
+			};
+		}
+		auto const &mesh { mpGeometryBuffer->getMesh( *meshId ) };
+		upload(
+			vertices.data(), vertices.size_bytes(), mpGeometryBuffer->getVertexBuffer(),
+			static_cast<vk::DeviceSize>( mesh.vertexOffset ) * sizeof(Vertex2D)
+		);
+		auto const uploadTicket {
+			upload(
+				indices.data(), indices.size_bytes(), mpGeometryBuffer->getIndexBuffer(),
+				vk::DeviceSize{ mesh.firstIndex } * sizeof(u32)
+			)
+		};
+		mpGeometryBuffer->setUploadTicket( *meshId, uploadTicket ); // NOTE: both copies are recorded into the same batch
+		return *meshId;
+	} // end-of-function: Renderer::addMesh
+	
+	
+	
+	[[nodiscard]] Renderer::FrameUniforms
+	Renderer::allocateFrameUniforms( u32 const frameSlot )
+	{
 		// pre-condition(s):
 		//   shouldn't be null unless the function is called in the wrong order:
-		assert( mpDevice     != nullptr );
-		assert( mpRenderPass != nullptr );
+		assert( mpUniformRing != nullptr );
+		
+		// NOTE: one allocation per frame; the camera first, followed by the object uniforms of every draw
+		auto const cameraSize   { mpUniformRing->getAlignedSize( sizeof(CameraUniforms) ) };
+		auto const objectStride { mpUniformRing->getAlignedSize( sizeof(ObjectUniforms) ) };
+		auto const requiredSize { cameraSize + mDrawList.getSize() * objectStride };
+		auto slice { mpUniformRing->allocate( frameSlot, requiredSize ) };
+		if ( not slice ) [[unlikely]] {
+			spdlog::info( "... frame #{} needs {} bytes of uniform data; growing the uniform ring", mCurrentFrame, requiredSize );
+			makeUniformRing( std::max( requiredSize, 2 * mpUniformRing->getRegionSize() ) );
+			slice = mpUniformRing->allocate( frameSlot, requiredSize );
+			assert( slice.has_value() );
+		}
+		std::memcpy( slice->pData, &mCameraUniforms, sizeof(CameraUniforms) );
+		return FrameUniforms {
+			.descriptorSet = mpUniformRing->getDescriptorSet(),
+			.cameraOffset  = slice->offset,
+			.objectsOffset = slice->offset + static_cast<u32>( cameraSize ),
+			.objectStride  = static_cast<u32>( objectStride ),
+			.pObjects      = static_cast<char *>( slice->pData ) + cameraSize
+		};
+	} // end-of-function: Renderer::allocateFrameUniforms
+	
+	
+	
+	[[nodiscard]] bool
+	Renderer::recordCommandBuffer(
+		FrameContext        &frameContext,
+		FrameUniforms const &frameUniforms,
+		u32           const  imageIndex,
+		u32           const  frameSlot
+	) const
+	{
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpRenderPass       != nullptr );
+		assert( mpGraphicsPipeline != nullptr );
+		assert( mpWorkerPool       != nullptr );
+		//   the image index must come from the current swapchain:
+		assert( imageIndex < mImageViews.size() );
+		assert( frameSlot  < RendererConfig::kMaxFramesInFlight );
+		
+		auto const &framebuffer { mFramebuffers[getFramebufferIndex( imageIndex, frameSlot )] };
+		
+		auto const draws { mDrawList.getCommands() };
+		
+		// NOTE: The draw list is split into contiguous slices that are recorded into secondary command buffers
+		//       in parallel; each slice has its own command pool so no pool is ever shared between threads.
+		//       Small draw lists are recorded inline since the per-slice overhead would outweigh the gains.
+		auto const sliceCount {
+			static_cast<u32>( std::min<u64>( mpWorkerPool->getWorkerCount(), draws.size() / kMinDrawsPerRecordingSlice ) )
+		};
+		bool const isParallel { sliceCount > 1 };
 		
-		mpCommandBuffers = makeCommandBuffers( vk::CommandBufferLevel::ePrimary, mFramebufferCount ); // TODO(1.0)
-		vk::ClearValue const clearValue { .color = {{{ 0.02f, 0.02f, 0.02f, 1.0f }}} };
+		std::array const clearValues {
+			vk::ClearValue { .color        = {{{ 0.02f, 0.02f, 0.02f, 1.0f }}}         },
+			vk::ClearValue { .depthStencil = { .depth = 1.0f, .stencil = 0 } } // i.e. the far plane
+		};
 		
-		for ( u32 index{0}; index < mFramebufferCount; ++index ) {
-			auto &commandBuffer = (*mpCommandBuffers)[index];
-			commandBuffer.begin( {} );
-			commandBuffer.beginRenderPass(
-				vk::RenderPassBeginInfo {
-					.renderPass      = **mpRenderPass,
-					.framebuffer     = *(mFramebuffers)[index],
-					.renderArea      = vk::Rect2D {
-					                    .extent = mSurfaceExtent,
-					                 },
-					.clearValueCount = 1, // TODO(explain)
-					.pClearValues    = &clearValue
-				},
-				vk::SubpassContents::eInline // inline; no secondary command buffers allowed
+		auto &commandBuffer { (*frameContext.primary.pCommandBuffers)[0] };
+		commandBuffer.begin( { .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit } );
+		mpGpuProfiler->recordReset( commandBuffer );
+		auto const renderPassScope { mpGpuProfiler->beginScope( commandBuffer, "render pass" ) };
+		commandBuffer.beginRenderPass(
+			vk::RenderPassBeginInfo {
+				.renderPass      = **mpRenderPass,
+				.framebuffer     = *framebuffer,
+				.renderArea      = vk::Rect2D {
+				                    .extent = mSurfaceExtent,
+				                 },
+				.clearValueCount = static_cast<u32>( clearValues.size() ), // one per attachment
+				.pClearValues    = clearValues.data()
+			},
+			isParallel ? vk::SubpassContents::eSecondaryCommandBuffers : vk::SubpassContents::eInline
+		);
+		if ( isParallel ) {
+			vk::CommandBufferInheritanceInfo const inheritanceInfo {
+				.renderPass  = **mpRenderPass,
+				.subpass     =   0,
+				.framebuffer = * framebuffer
+			};
+			// NOTE: scopes are reserved up front since only the recording thread may reserve them
+			std::vector<GpuProfiler::Scope> sliceScopes;
+			sliceScopes.reserve( sliceCount );
+			for ( u32 sliceIndex{0}; sliceIndex < sliceCount; ++sliceIndex )
+				sliceScopes.push_back( mpGpuProfiler->reserveScope( fmt::format( "draw slice #{}", sliceIndex ) ) );
+			mpWorkerPool->parallelFor(
+				sliceCount,
+				[&]( u32 const sliceIndex, u32 /*workerIndex*/ ) {
+					auto const sliceBegin { draws.size() *  sliceIndex      / sliceCount };
+					auto const sliceEnd   { draws.size() * (sliceIndex + 1) / sliceCount };
+					auto &secondary { (*frameContext.secondaries[sliceIndex].pCommandBuffers)[0] };
+					secondary.begin(
+						vk::CommandBufferBeginInfo {
+							.flags            = vk::CommandBufferUsageFlagBits::eOneTimeSubmit
+							                  | vk::CommandBufferUsageFlagBits::eRenderPassContinue,
+							.pInheritanceInfo = &inheritanceInfo
+						}
+					);
+					mpGpuProfiler->writeBegin( secondary, sliceScopes[sliceIndex] );
+					recordPipelineState( secondary ); // NOTE: secondaries don't inherit bound state
+					recordDraws( secondary, frameUniforms, draws.subspan( sliceBegin, sliceEnd - sliceBegin ), sliceBegin );
+					mpGpuProfiler->writeEnd( secondary, sliceScopes[sliceIndex] );
+					secondary.end();
+				}
 			);
-			commandBuffer.bindPipeline(
+			std::vector<vk::CommandBuffer> secondaries;
+			secondaries.reserve( sliceCount );
+			for ( u32 sliceIndex{0}; sliceIndex < sliceCount; ++sliceIndex )
+				secondaries.push_back( *(*frameContext.secondaries[sliceIndex].pCommandBuffers)[0] );
+			commandBuffer.executeCommands( secondaries );
+		}
+		else {
+			auto const drawScope { mpGpuProfiler->beginScope( commandBuffer, "draws" ) };
+			recordPipelineState( commandBuffer );
+			recordDraws( commandBuffer, frameUniforms, draws, 0 );
+			mpGpuProfiler->endScope( commandBuffer, drawScope );
+		}
+		commandBuffer.endRenderPass();
+		mpGpuProfiler->endScope( commandBuffer, renderPassScope );
+		if ( mIsReadbackRequested ) [[unlikely]] {
+			auto const readbackScope { mpGpuProfiler->beginScope( commandBuffer, "readback" ) };
+			recordReadback( commandBuffer, imageIndex );
+			mpGpuProfiler->endScope( commandBuffer, readbackScope );
+		}
+		commandBuffer.end();
+		return isParallel;
+	} // end-of-function: Renderer::recordCommandBuffer
+	
+	
+	
+	void
+	Renderer::recordPipelineState( vk::raii::CommandBuffer &commandBuffer ) const
+	{
+		commandBuffer.bindPipeline(
+			vk::PipelineBindPoint::eGraphics,
+			**mpGraphicsPipeline
+		);
+		// NOTE: the descriptor set is bound per draw (see: recordDraws) since its dynamic offsets differ
+		commandBuffer.setViewport(
+			0,
+			vk::Viewport {
+				.x        = 0.0f,
+				.y        = 0.0f,
+				.width    = static_cast<f32>( mSurfaceExtent.width  ),
+				.height   = static_cast<f32>( mSurfaceExtent.height ),
+				.minDepth = 0.0f,
+				.maxDepth = 1.0f
+			}
+		);
+		commandBuffer.setScissor(
+			0,
+			vk::Rect2D {
+				.offset = { 0, 0 },
+				.extent = mSurfaceExtent
+			}
+		);
+	} // end-of-function: Renderer::recordPipelineState
+	
+	
+	
+	void
+	Renderer::recordDraws(
+		vk::raii::CommandBuffer      &commandBuffer,
+		FrameUniforms          const &frameUniforms,
+		std::span<DrawCommand const>  draws,
+		u64                    const  firstDrawIndex
+	) const
+	{
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpDefaultTexture != nullptr );
+		
+		// NOTE: consecutive draws sharing buffers (or textures) skip the redundant binds
+		vk::Buffer        boundVertexBuffer {};
+		vk::DeviceSize    boundVertexOffset { 0 };
+		vk::Buffer        boundIndexBuffer  {};
+		vk::DeviceSize    boundIndexOffset  { 0 };
+		vk::IndexType     boundIndexType    { vk::IndexType::eUint16 };
+		vk::DescriptorSet boundTextureSet   {};
+		for ( auto drawIndex { firstDrawIndex }; auto const &draw: draws ) {
+			// NOTE: each draw owns a slot in the frame's uniform data; only the dynamic offset changes between draws
+			auto const objectOffset { drawIndex++ * frameUniforms.objectStride };
+			std::memcpy( static_cast<char *>( frameUniforms.pObjects ) + objectOffset, &draw.object, sizeof(ObjectUniforms) );
+			std::array const dynamicOffsets {
+				frameUniforms.cameraOffset,
+				frameUniforms.objectsOffset + static_cast<u32>( objectOffset )
+			};
+			commandBuffer.bindDescriptorSets(
 				vk::PipelineBindPoint::eGraphics,
-				**mpGraphicsPipeline
+				**mpGraphicsPipelineLayout,
+				0,
+				{ frameUniforms.descriptorSet },
+				dynamicOffsets
 			);
-			// TODO(later): commandBuffer.bindDescriptorSets(
-			// TODO(later): 	vk::PipelineBindPoint::eGraphics,
-			// TODO(later): 	*pipelineLayout,
-			// TODO(later): 	0,
-			// TODO(later): 	{ *descriptorSet },
-			// TODO(later): 	nullptr
-			// TODO(later): );
-			commandBuffer.bindVertexBuffers( 0, { *mpVertexBuffer->handle }, { 0 } );
-			commandBuffer.bindIndexBuffer( *mpIndexBuffer->handle, 0, vk::IndexType::eUint16 );
-			// NOTE(possibility): command_buffer.bindDescriptorSets()
-			// NOTE(possibility): command_buffer.setViewport()
-			// NOTE(possibility): command_buffer.setScissor()
+			if ( auto const textureSet { draw.textureSet ? draw.textureSet : mpDefaultTexture->getDescriptorSet() }; textureSet != boundTextureSet ) {
+				commandBuffer.bindDescriptorSets( vk::PipelineBindPoint::eGraphics, **mpGraphicsPipelineLayout, 1, { textureSet }, {} );
+				boundTextureSet = textureSet;
+			}
+			if ( draw.vertexBuffer != boundVertexBuffer or draw.vertexBufferOffset != boundVertexOffset ) {
+				commandBuffer.bindVertexBuffers( 0, { draw.vertexBuffer }, { draw.vertexBufferOffset } );
+				boundVertexBuffer = draw.vertexBuffer;
+				boundVertexOffset = draw.vertexBufferOffset;
+			}
+			if ( draw.indexBuffer != boundIndexBuffer or draw.indexBufferOffset != boundIndexOffset or draw.indexType != boundIndexType ) {
+				commandBuffer.bindIndexBuffer( draw.indexBuffer, draw.indexBufferOffset, draw.indexType );
+				boundIndexBuffer = draw.indexBuffer;
+				boundIndexOffset = draw.indexBufferOffset;
+				boundIndexType   = draw.indexType;
+			}
 			commandBuffer.drawIndexed(
-				static_cast<u32>( kRectangleIndices.size() ), // index count
-				1, // instance count
-				0, // first index
-				0, // vertex offset
-				0  // first instance
+				draw.indexCount,
+				draw.instanceCount,
+				draw.firstIndex,
+				draw.vertexOffset,
+				draw.firstInstance
 			);
-			commandBuffer.endRenderPass();
-			commandBuffer.end();
 		}
-	} // end-of-function: Renderer::makeCommandBuffers
+	} // end-of-function: Renderer::recordDraws
+	
+	
+	
+	void
+	Renderer::reportRecordingStats()
+	{
+		if ( mRecordingStats.frameCount == 0 ) [[unlikely]]
+			return;
+		auto const frameCount { static_cast<f64>( mRecordingStats.frameCount ) };
+		spdlog::info(
+			"[record]: {} frame(s) ({} in parallel on up to {} worker(s)), {:.1f} draw(s)/frame, {:.3f} ms/frame avg, {:.3f} ms max",
+			mRecordingStats.frameCount,
+			mRecordingStats.parallelFrameCount,
+			mpWorkerPool->getWorkerCount(),
+			static_cast<f64>( mRecordingStats.drawCount ) / frameCount,
+			mRecordingStats.totalMs / frameCount,
+			mRecordingStats.maxMs
+		);
+		mRecordingStats = {};
+	} // end-of-function: Renderer::reportRecordingStats
+	
+	
+	
+	void
+	Renderer::countStagingFallback( vk::DeviceSize const size )
+	{
+		// NOTE: only the first one is logged on the spot, since e.g. loading many meshes can trigger one per upload
+		if ( mStagingStats.totalFallbackCount == 0 ) [[unlikely]]
+			spdlog::warn(
+				"Staging ring exhausted; falling back on dedicated staging buffers (consider a larger `staging-ring-size` than {} MiB)",
+				mConfig.stagingRingSizeMiB
+			);
+		++mStagingStats.fallbackCount;
+		++mStagingStats.totalFallbackCount;
+		mStagingStats.fallbackSize += size;
+	} // end-of-function: Renderer::countStagingFallback
+	
+	
+	
+	void
+	Renderer::reportStagingStats()
+	{
+		if ( mStagingStats.fallbackCount == 0 ) [[likely]]
+			return;
+		spdlog::warn(
+			"[staging]: {} upload(s) ({} byte(s)) fell back on dedicated staging buffers since the last report",
+			mStagingStats.fallbackCount,
+			mStagingStats.fallbackSize
+		);
+		mStagingStats.fallbackCount = 0;
+		mStagingStats.fallbackSize  = 0;
+	} // end-of-function: Renderer::reportStagingStats
+	
+	
+	
+	void
+	Renderer::reportLatencyStats()
+	{
+		if ( mLatencyStats.frameCount == 0 ) [[unlikely]]
+			return;
+		spdlog::info(
+			"[latency]: {} frame(s), {:.3f} ms avg input-to-present, {:.3f} ms max (pacing: {}, {:.3f} ms period, {:.3f} ms predicted work)",
+			mLatencyStats.frameCount,
+			mLatencyStats.totalMs / static_cast<f64>( mLatencyStats.frameCount ),
+			mLatencyStats.maxMs,
+			isFramePacingEnabled() ? "on" : "off",
+			mFramePacer.getFramePeriodMs(),
+			mFramePacer.getPredictedWorkMs()
+		);
+		mLatencyStats = {};
+	} // end-of-function: Renderer::reportLatencyStats
+	
+	
+	
+	[[nodiscard]] bool
+	Renderer::isFramePacingEnabled() const noexcept
+	{
+		// NOTE: without presentation there's no deadline to pace towards
+		return not isHeadless()
+		   and mConfig.presentationPriority == PresentationPriority::eMinimalLatency
+		   and mConfig.isFramePacingEnabled;
+	} // end-of-function: Renderer::isFramePacingEnabled
 	
 	
 	
 	void
 	Renderer::makeSyncPrimitives()
 	{
-		// TODO(refactor)
-		spdlog::info( "Creating synchronization primitive(s)..." );
-		
-		mImagePresentable .clear();
-		mImageAvailable   .clear();
-		mFencesInFlight   .clear();
-		mImagePresentable .reserve( kMaxConcurrentFrames );
-		mImageAvailable   .reserve( kMaxConcurrentFrames );
-		mFencesInFlight   .reserve( kMaxConcurrentFrames );
-		for ( auto i{0u}; i < kMaxConcurrentFrames; ++i ) {
+		spdlog::info( "Creating synchronization primitive(s) for {} frame(s) in flight...", mConfig.framesInFlight );
+		
+		// NOTE: The presentation engine may still hold on to the previous semaphores (if any),
+		//       so they're retired rather than destroyed on the spot.
+		if ( not mImagePresentable.empty() ) [[unlikely]] {
+			retire( std::move( mImagePresentable ) );
+			retire( std::move( mImageAvailable   ) );
+			mImagePresentable.clear();
+			mImageAvailable  .clear();
+		}
+		
+		// NOTE: the swapchain only works with binary semaphores, so those stay one per frame slot
+		mImagePresentable .reserve( mConfig.framesInFlight );
+		mImageAvailable   .reserve( mConfig.framesInFlight );
+		for ( auto i{0u}; i < mConfig.framesInFlight; ++i ) {
 			mImagePresentable .emplace_back( mpDevice->createSemaphore({}) );
 			mImageAvailable   .emplace_back( mpDevice->createSemaphore({}) );
-			mFencesInFlight   .emplace_back( mpDevice->createFence({.flags = vk::FenceCreateFlagBits::eSignaled}) );
 		}
 	} // end-of-function: Renderer::makeSyncPrimitives()
 	
 	
 	
+	void
+	Renderer::waitForFrames( u64 const frameCount )
+	{
+		// NOTE: A timeout isn't fatal by itself (e.g. a very long frame or a paused debugger), but the GPU might've hung,
+		//       so it's logged every time the timeout runs out (a lost device is thrown by the wait instead).
+		for ( u64 timeoutCount{1}; not mpFrameTimeline->waitFor( frameCount, kFrameWaitTimeout ); ++timeoutCount )
+			spdlog::warn(
+				"Still waiting for frame #{} to complete after {} s (the GPU may be hung)...",
+				frameCount - 1, timeoutCount * kFrameWaitTimeout / 1'000'000'000
+			);
+	} // end-of-function: Renderer::waitForFrames
+	
+	
+	
+	void
+	Renderer::applyPendingConfig()
+	{
+		PROFILE_FUNCTION();
+		
+		// pre-condition(s):
+		assert( mPendingConfig.has_value() );
+		
+		auto config { *std::exchange( mPendingConfig, std::nullopt ) };
+		if ( config.stagingRingSizeMiB != mConfig.stagingRingSizeMiB ) [[unlikely]] {
+			spdlog::warn( "The staging ring size can't be changed at run-time; keeping {} MiB", mConfig.stagingRingSizeMiB );
+			config.stagingRingSizeMiB = mConfig.stagingRingSizeMiB;
+		}
+		if ( config == mConfig ) [[unlikely]]
+			return;
+		config.log();
+		
+		bool const isSwapchainAffected {
+			not isHeadless()
+			and ( config.presentationPriority   != mConfig.presentationPriority
+			or    config.framebufferingPriority != mConfig.framebufferingPriority )
+		};
+		bool const areSlotsAffected { config.framesInFlight != mConfig.framesInFlight };
+		
+		if ( areSlotsAffected ) {
+			// NOTE: Frames map onto slots differently from here on, so the slots are drained once
+			//       (oldest first, as the staging ring releases its space in submission order).
+			auto const previousSlotCount { mConfig.framesInFlight };
+			waitForFrames( mCurrentFrame );
+			for ( auto frame { mCurrentFrame - std::min<u64>( mCurrentFrame, previousSlotCount ) }; frame < mCurrentFrame; ++frame )
+				mpStagingRing->beginFrame( static_cast<u32>( frame % previousSlotCount ) );
+		}
+		
+		mConfig = config;
+		if ( areSlotsAffected )
+			makeSyncPrimitives();
+		if ( isSwapchainAffected )
+			generateDynamicState();
+	} // end-of-function: Renderer::applyPendingConfig
+	
+	
+	
 	void
 	Renderer::generateDynamicState()
 	{
-		// TODO(cleanup): Might need to clean up mpCommandBuffers, mDescriptors, whatever here (IMPORTANT!!!) TODO TODO TODO TODO TODO
-		// TODO(cleanup): Might need to clean up mpCommandBuffers, mDescriptors, whatever here (IMPORTANT!!!) TODO TODO TODO TODO TODO
-		// TODO(cleanup): Might need to clean up mpCommandBuffers, mDescriptors, whatever here (IMPORTANT!!!) TODO TODO TODO TODO TODO
-		// TODO(cleanup): Might need to clean up mpCommandBuffers, mDescriptors, whatever here (IMPORTANT!!!) TODO TODO TODO TODO TODO
+		PROFILE_FUNCTION();
+		// TODO(cleanup): Might need to clean up mDescriptors, whatever here once they depend on the swapchain
 		// TODO(refactor)
-		spdlog::debug( "Generating dynamic state..." );
+		LOG_DEBUG( "Generating dynamic state..." );
+		
+		// pre-condition(s):
+		//   offscreen images never go out of date:
+		assert( not isHeadless() );
 		
-		// delete previous state (if any) in the right order:
+		// handle minimization:
+		if ( not mpWindow->waitResize() ) [[unlikely]]
+			return; // closed while minimized; the current state is kept until destruction
+		
+		// NOTE: Instead of draining the GPU with a device-wide wait, the previous state is retired and
+		//       only destroyed once all frames that could have used it have completed.
+		//       The render pass, pipeline layout, and pipeline are kept since they don't depend on the extent,
+		//       and command buffers are re-recorded every frame so they never reference stale framebuffers.
+		RetiredDynamicState retired {
+			.pRenderPass     = nullptr,
+			.pPipeline       = nullptr,
+			.pSwapchain      = std::move( mpSwapchain      ),
+			.imageViews      = std::move( mImageViews      ),
+			.depthImages     = std::move( mDepthImages     ),
+			.depthImageViews = std::move( mDepthImageViews ),
+			.framebuffers    = std::move( mFramebuffers    )
+		};
 		mImages.clear();
 		mImageViews.clear();
+		mDepthImages.clear();
+		mDepthImageViews.clear();
 		mFramebuffers.clear();
-		if ( mpCommandBuffers ) {
-			mpCommandBuffers->clear();
-			mpCommandBuffers.reset();
-		}
-		if ( mpGraphicsPipeline )
-			mpGraphicsPipeline.reset();
-		if ( mpSwapchain )
-			mpSwapchain.reset();
-		
-		assert( mFramebuffers.empty()         );
-		assert( mpCommandBuffers   == nullptr );
-		assert( mpGraphicsPipeline == nullptr );
-		assert( mpSwapchain        == nullptr );
-		
-		// handle minimization:
-		mpWindow->waitResize();
-		mpDevice->waitIdle();	
 		
-		makeSwapchain();
-		makeGraphicsPipeline();
+		assert( mpSwapchain == nullptr );
+		
+		auto const previousSurfaceFormat { mSurfaceFormat };
+		// the retiring swapchain is handed over so that the presentation engine can reuse its resources:
+		makeSwapchain( retired.pSwapchain ? **retired.pSwapchain : vk::SwapchainKHR {} );
+		if ( mSurfaceFormat != previousSurfaceFormat ) [[unlikely]] {
+			spdlog::info( "... surface format changed; remaking render pass and graphics pipeline" );
+			retired.pPipeline   = std::move( mpGraphicsPipeline );
+			retired.pRenderPass = std::move( mpRenderPass       );
+			makeRenderPass();
+			makeGraphicsPipeline();
+		}
+		makeDepthImages(); // the extent may have changed
 		makeFramebuffers();
-		makeCommandBuffers();
+		
+		retire( std::move( retired ) );
+		spdlog::info( "... retired previous dynamic state on frame #{} ({} pending deletion(s))", mCurrentFrame, mpDeletionQueue->getSize() );
+		mFramePacer.reset(); // the present mode (and thereby the frame period) may have changed
 	} // end-of-function: Renderer::generateDynamicState
 	
 	
 	
-	Renderer::Renderer():
+	void
+	Renderer::reportDeletionStats() const
+	{
+		auto const stats { mpDeletionQueue->getStats() };
+		spdlog::info(
+			"[deletion]: {} retired, {} destroyed, {} pending (peak {}), {:.1f} frame(s) avg latency, {} max",
+			stats.retiredCount,
+			stats.destroyedCount,
+			stats.pendingCount,
+			stats.pendingHighWaterMark,
+			stats.destroyedCount ? static_cast<f64>( stats.totalLatency ) / static_cast<f64>( stats.destroyedCount ) : 0.0,
+			stats.maxLatency
+		);
+	} // end-of-function: Renderer::reportDeletionStats
+	
+	
+	
+	Renderer::Renderer( DisplayMode const displayMode, RendererConfig const &config, vk::Extent2D const headlessExtent ):
+		mDisplayMode           { displayMode    },
+		mHeadlessExtent        { headlessExtent },
+		mConfig                { config         },
+		mPendingConfig         {                },
+		mApiVersion            { VK_API_VERSION_1_1 },
+		mHasTimelineSemaphores { false },
+		mPipelineCreationCount { 0     },
+		mPipelineCacheHitCount { 0     },
+		mRectangleMesh         { 0     },
+		mCameraUniforms        {       },
 		mShouldRemakeSwapchain { false },
-		mCurrentFrame          { 0     }
+		mCurrentFrame          { 0     },
+		mDrawList              {       },
+		mpReadbackBuffer       {       },
+		mIsReadbackRequested   { false },
+		mPendingReadbackFrame  {       },
+		mRecordingStats        {       },
+		mFrameTimings          {       },
+		mLatencyStats          {       },
+		mFramePacer            {       },
+		mStagingStats          {       },
+		mHasBegunFrame         { false }
 	{
-		spdlog::info( "Constructing a Renderer instance..." );
+		spdlog::info( "Constructing a {} Renderer instance...", isHeadless() ? "headless" : "windowed" );
+		mConfig.validate();
+		mConfig.log();
 		// "fixed" part:
-		mpGlfwInstance = std::make_unique<GlfwInstance>();
+		if ( not isHeadless() ) [[likely]]
+			mpGlfwInstance = std::make_unique<GlfwInstance>();
 		makeVkContext();
 		makeVkInstance();
 		maybeMakeDebugMessenger();
-		mpWindow = std::make_unique<Window>( *mpGlfwInstance, *mpVkInstance, mShouldRemakeSwapchain );
+		if ( not isHeadless() ) [[likely]]
+			mpWindow = std::make_unique<Window>( *mpGlfwInstance, *mpVkInstance, mShouldRemakeSwapchain );
 		selectPhysicalDevice();
 		selectQueueFamilies(); // TODO: pick a better name
 		makeLogicalDevice();
+		mpAllocator = std::make_unique<Allocator>( *mpPhysicalDevice, *mpDevice );
+		makePipelineCache();
 		makeQueues();
+		openAssetPackage();
+		mpWorkerPool = std::make_unique<WorkerPool>();
+		spdlog::info( "Created a worker pool with {} worker(s)", mpWorkerPool->getWorkerCount() );
 		makeCommandPools();
+		mpUploadService = std::make_unique<UploadService>( *mpDevice, *mpTransferQueue, *mpGraphicsQueue, mQueueFamilyIndices );
+		mpSamplerCache  = std::make_unique<SamplerCache>( *mpDevice );
+		makeTextureDescriptorPool();
+		mpDeletionQueue = std::make_unique<DeletionQueue>();
+		mpGpuProfiler   = std::make_unique<GpuProfiler>( *mpDevice, *mpPhysicalDevice, mQueueFamilyIndices.graphicsIndex, RendererConfig::kMaxFramesInFlight );
+		mpFrameTimeline = std::make_unique<FrameTimeline>( *mpDevice, mHasTimelineSemaphores, RendererConfig::kMaxFramesInFlight );
+		makeStagingRing();
 		// "dynamic" part:
-		makeSwapchain();
+		if ( isHeadless() ) [[unlikely]]
+			makeOffscreenImages();
+		else
+			makeSwapchain();
+		selectDepthFormat();
+		makeDepthImages();
+		makeGraphicsPipelineLayout();
+		makeUniformRing( kUniformRingRegionSize );
+		makeRenderPass();
 		makeGraphicsPipeline();
 		makeFramebuffers();
-		makeVertexBuffer();
-		makeIndexBuffer();
-		makeCommandBuffers();
-		makeSyncPrimitives(); // TODO(config): refactor so it is updated whenever framebuffer count changes
+		makeGeometryBuffer();
+		makeDefaultTexture();
+		mpUploadService->flush(); // NOTE: the graphics queue acquires ownership before the first frame is submitted
+		makeSyncPrimitives(); // NOTE: remade by `applyPendingConfig` whenever the frames in flight change
+		mpAllocator->logStats();
 	//instance
 	} // end-of-function: Renderer::Renderer
 	
@@ -1461,12 +2477,38 @@ namespace gfx {
 	{
 		spdlog::info( "Destroying a Renderer instance..." );
 		mpDevice->waitIdle();
-		if ( mpCommandBuffers )
-			mpCommandBuffers->clear();
+		reportDeletionStats();
+		mpDeletionQueue->flush();
+		reportRecordingStats();
+		reportLatencyStats();
+		reportStagingStats();
+		mpGpuProfiler->logStats();
+		if constexpr ( kIsDebugMode ) {
+			try {
+				mpGpuProfiler->writeChromeTrace( kGpuTraceFilename );
+			}
+			catch ( std::exception const &e ) {
+				spdlog::error( "Failed to write the GPU trace: \"{}\"!", e.what() );
+			}
+		}
+		try {
+			savePipelineCache();
+		}
+		catch ( std::exception const &e ) {
+			spdlog::error( "Failed to save the pipeline cache: \"{}\"!", e.what() );
+		}
 	} // end-of-function: Renderer::~Renderer
 	
 	
 	
+	[[nodiscard]] bool
+	Renderer::isHeadless() const noexcept
+	{
+		return mDisplayMode == DisplayMode::eHeadless;
+	} // end-of-function: Renderer::isHeadless
+	
+	
+	
 	[[nodiscard]] Window const &
 	Renderer::getWindow() const
 	{
@@ -1484,23 +2526,538 @@ namespace gfx {
 	} // end-of-function: Renderer::getWindow
 	
 	
-   
-	void
-	Renderer::operator()()
+	
+	[[nodiscard]] DrawList &
+	Renderer::getDrawList() noexcept
 	{
-		auto const frame = mCurrentFrame % kMaxConcurrentFrames;
-		if constexpr ( kIsDebugMode ) spdlog::info( "[draw]: Drawing frame #{} (@{})...", mCurrentFrame, frame );
+		return mDrawList;
+	} // end-of-function: Renderer::getDrawList
+	
+	
+	
+	[[nodiscard]] DrawCommand
+	Renderer::getRectangleDrawCommand() const noexcept
+	{
+		return getMeshDrawCommand( mRectangleMesh );
+	} // end-of-function: Renderer::getRectangleDrawCommand
+	
+	
+	
+	[[nodiscard]] std::vector<MeshId>
+	Renderer::loadMeshes( std::span<std::filesystem::path const> paths )
+	{
+		PROFILE_FUNCTION();
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpWorkerPool != nullptr );
 		
+		if ( paths.empty() ) [[unlikely]]
+			return {};
+		spdlog::info( "Loading the meshes of {} glTF file(s)...", paths.size() );
+		
+		f64 parseMs { 0 };
+		f64 stageMs { 0 };
+		std::vector<MeshFile> files( paths.size() );
 		{
-			auto const waitResult {
-				mpDevice->waitForFences( *mFencesInFlight[frame], VK_TRUE, kDrawWaitTimeout )
+			// NOTE: one file per task, so the files are parsed (and converted) in parallel but each on a single thread
+			ScopedTimer const parseTimer { parseMs };
+			mpWorkerPool->parallelFor(
+				static_cast<u32>( paths.size() ),
+				[&]( u32 const taskIndex, u32 ) { files[taskIndex].loadFile( paths[taskIndex] ); }
+			);
+		}
+		std::vector<MeshId> meshIds;
+		u64                 byteSize { 0 };
+		{
+			ScopedTimer const stageTimer { stageMs };
+			for ( auto const &file: files ) {
+				byteSize += file.byteSize;
+				for ( auto const &mesh: file.meshes )
+					meshIds.push_back( addMesh( mesh.vertices, mesh.indices ) );
+			}
+		}
+		
+		auto const seconds { (parseMs + stageMs) / 1'000.0 };
+		spdlog::info(
+			"... loaded {} mesh(es) from {} byte(s) in {:.3f} ms ({:.3f} ms parsing on {} worker(s), {:.3f} ms staging): {:.1f} MB/s, {:.0f} meshes/s",
+			meshIds.size(), byteSize, parseMs + stageMs, parseMs, mpWorkerPool->getWorkerCount(), stageMs,
+			static_cast<f64>( byteSize ) / 1'000'000.0 / seconds, static_cast<f64>( meshIds.size() ) / seconds
+		);
+		return meshIds;
+	} // end-of-function: Renderer::loadMeshes
+	
+	
+	
+	[[nodiscard]] DrawCommand
+	Renderer::getMeshDrawCommand( MeshId const meshId ) const noexcept
+	{
+		// pre-condition(s):
+		assert( mpGeometryBuffer != nullptr );
+		
+		return mpGeometryBuffer->makeDrawCommand( meshId );
+	} // end-of-function: Renderer::getMeshDrawCommand
+	
+	
+	
+	[[nodiscard]] bool
+	Renderer::isMeshReady( MeshId const meshId )
+	{
+		assert( mpUploadService  != nullptr );
+		assert( mpGeometryBuffer != nullptr );
+		return mpUploadService->isComplete( mpGeometryBuffer->getMesh( meshId ).uploadTicket );
+	} // end-of-function: Renderer::isMeshReady
+	
+	
+	
+	void
+	Renderer::setCamera( CameraUniforms const &camera ) noexcept
+	{
+		mCameraUniforms = camera;
+	} // end-of-function: Renderer::setCamera
+	
+	
+	
+	[[nodiscard]] std::unique_ptr<Texture>
+	Renderer::makeTexture(
+		std::span<std::byte const>         pixels,
+		vk::Extent2D                const  extent,
+		vk::Format                  const  format,
+		vk::SamplerCreateInfo       const &samplerCreateInfo,
+		bool                        const  shouldGenerateMips
+	)
+	{
+		spdlog::info( "Making a {}x{} `{}` texture...", extent.width, extent.height, to_string( format ) );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpPhysicalDevice != nullptr );
+		
+		// NOTE: the whole span is copied to the image, so it has to hold exactly the first mip level:
+		if ( extent.width == 0 or extent.height == 0 ) [[unlikely]]
+			throw std::runtime_error { "Textures can't be empty!" };
+		auto const expectedByteSize { getImageByteSize( format, extent ) };
+		if ( expectedByteSize == 0 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Texture format `{}` is unsupported!", to_string( format ) ) };
+		if ( pixels.size() != expectedByteSize ) [[unlikely]]
+			throw std::runtime_error {
+				fmt::format(
+					"A {}x{} `{}` texture takes {} byte(s) of pixels, not {}!",
+					extent.width, extent.height, to_string( format ), expectedByteSize, pixels.size()
+				)
 			};
-			if ( waitResult != vk::Result::eSuccess )
-				throw std::runtime_error { "Draw fence wait timed out!" }; // TEMP: handle eTimeout properly
+		
+		auto const formatFeatures { mpPhysicalDevice->getFormatProperties( format ).optimalTilingFeatures };
+		if ( not (formatFeatures & vk::FormatFeatureFlagBits::eSampledImage) ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Texture format `{}` can't be sampled on this device!", to_string( format ) ) };
+		
+		// NOTE: The mip chain is blitted on upload (see: UploadService::recordMipChains), so the format has to support
+		//       blits (which e.g. block compressed formats don't; those have to come with their mips pre-generated).
+		//       Formats without linear filtering support are downsampled with nearest filtering instead.
+		bool const canGenerateMips {
+			(formatFeatures & vk::FormatFeatureFlagBits::eBlitSrc) and (formatFeatures & vk::FormatFeatureFlagBits::eBlitDst)
+		};
+		if ( shouldGenerateMips and not canGenerateMips ) [[unlikely]]
+			spdlog::warn( "... `{}` doesn't support blits; the texture won't have a mip chain!", to_string( format ) );
+		auto const mipLevelCount {
+			shouldGenerateMips and canGenerateMips ? static_cast<u32>( std::bit_width( std::max( extent.width, extent.height ) ) ) : 1u
+		};
+		auto const mipGeneration {
+			mipLevelCount == 1 ? std::nullopt : std::optional<MipGeneration> {
+				MipGeneration {
+					.extent = extent,
+					.filter = formatFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear ? vk::Filter::eLinear : vk::Filter::eNearest
+				}
+			}
+		};
+		
+		return makeTextureFromLevels( pixels, extent, format, mipLevelCount, std::array { vk::DeviceSize { 0 } }, mipGeneration, samplerCreateInfo );
+	} // end-of-function: Renderer::makeTexture
+	
+	
+	
+	[[nodiscard]] std::unique_ptr<Texture>
+	Renderer::loadTexture(
+		std::span<std::filesystem::path const>         candidatePaths,
+		vk::SamplerCreateInfo                  const  &samplerCreateInfo
+	)
+	{
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpPhysicalDevice != nullptr );
+		
+		if ( candidatePaths.empty() ) [[unlikely]]
+			throw std::runtime_error { "No texture files to load from!" };
+		
+		auto const isSampleable {
+			[this]( vk::Format const format ) {
+				return static_cast<bool>( mpPhysicalDevice->getFormatProperties( format ).optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImage );
+			}
+		};
+		// NOTE: only the headers are read until a file is picked
+		auto const pickPath {
+			[&]() -> std::filesystem::path const & {
+				for ( auto const &path: candidatePaths )
+					if ( isSampleable( TextureFile::readFormat( path ) ) )
+						return path;
+				for ( auto const &path: candidatePaths )
+					if ( getBlockFormat( TextureFile::readFormat( path ) ) )
+						return path; // i.e. decoded on the CPU
+				throw std::runtime_error { fmt::format( "None of the `{}` texture files can be used on this device!", candidatePaths.front().string() ) };
+			}
+		};
+		auto const &path { pickPath() };
+		
+		TextureFile file;
+		file.loadFile( path );
+		spdlog::info(
+			"Loading a {}x{} `{}` texture with {} mip level(s) from `{}`...",
+			file.extent.width, file.extent.height, to_string( file.format ), file.levels.size(), path.string()
+		);
+		
+		auto format { file.format };
+		if ( not isSampleable( format ) ) {
+			auto const blockFormat { *getBlockFormat( format ) };
+			format = isSrgb( format ) ? vk::Format::eR8G8B8A8Srgb : vk::Format::eR8G8B8A8Unorm;
+			spdlog::warn( "... `{}` isn't supported by the device; decoding it into `{}` on the CPU", to_string( file.format ), to_string( format ) );
+			for ( u32 level{0}; level < file.levels.size(); ++level ) {
+				auto const levelExtent { getLevelExtent( file.extent, level ) };
+				file.levels[level] = bc::decodeImage( blockFormat, file.levels[level], levelExtent.width, levelExtent.height );
+			}
+		}
+		
+		// NOTE: each level starts at a multiple of 16 bytes, which satisfies the offset requirements of every texel block size
+		vk::DeviceSize constexpr kLevelAlignment { 16 };
+		std::vector<vk::DeviceSize> levelOffsets;
+		vk::DeviceSize              size { 0 };
+		for ( auto const &level: file.levels ) {
+			size = (size + kLevelAlignment - 1) / kLevelAlignment * kLevelAlignment;
+			levelOffsets.push_back( size );
+			size += level.size();
+		}
+		std::vector<std::byte> data( size );
+		for ( u32 level{0}; level < file.levels.size(); ++level )
+			std::memcpy( data.data() + levelOffsets[level], file.levels[level].data(), file.levels[level].size() );
+		
+		return makeTextureFromLevels(
+			data,
+			file.extent,
+			format,
+			static_cast<u32>( file.levels.size() ),
+			levelOffsets,
+			std::nullopt,
+			samplerCreateInfo
+		);
+	} // end-of-function: Renderer::loadTexture
+	
+	
+	
+	[[nodiscard]] std::unique_ptr<Texture>
+	Renderer::makeTextureFromLevels(
+		std::span<std::byte const>               data,
+		vk::Extent2D                     const   extent,
+		vk::Format                       const   format,
+		u32                              const   mipLevelCount,
+		std::span<vk::DeviceSize const>          levelOffsets,
+		std::optional<MipGeneration>     const   mipGeneration,
+		vk::SamplerCreateInfo            const  &samplerCreateInfo
+	)
+	{
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpPhysicalDevice        != nullptr );
+		assert( mpDevice                != nullptr );
+		assert( mpAllocator             != nullptr );
+		assert( mpSamplerCache          != nullptr );
+		assert( mpTextureDescriptorPool != nullptr );
+		assert( mpTextureSetLayout      != nullptr );
+		//   the levels that aren't generated have to be provided:
+		assert( levelOffsets.size() == (mipGeneration ? 1 : mipLevelCount) );
+		
+		auto const maxDimension { mpPhysicalDevice->getProperties().limits.maxImageDimension2D };
+		if ( extent.width == 0 or extent.height == 0 or extent.width > maxDimension or extent.height > maxDimension ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Unsupported texture extent {}x{} (max: {})!", extent.width, extent.height, maxDimension ) };
+		
+		auto imageHandle {
+			vk::raii::Image(
+				*mpDevice,
+				vk::ImageCreateInfo {
+					.imageType     = vk::ImageType::e2D,
+					.format        = format,
+					.extent        = vk::Extent3D { .width = extent.width, .height = extent.height, .depth = 1 },
+					.mipLevels     = mipLevelCount,
+					.arrayLayers   = 1,
+					.samples       = vk::SampleCountFlagBits::e1,
+					.tiling        = vk::ImageTiling::eOptimal,
+					.usage         = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled
+					               | (mipGeneration ? vk::ImageUsageFlagBits::eTransferSrc : vk::ImageUsageFlags {}), // i.e. blit source
+					.sharingMode   = vk::SharingMode::eExclusive, // NOTE: uploads hand ownership over to the graphics queue family
+					.initialLayout = vk::ImageLayout::eUndefined
+				}
+			)
+		};
+		auto imageAllocation { mpAllocator->allocate( imageHandle, vk::MemoryPropertyFlagBits::eDeviceLocal ) };
+		
+		vk::ImageSubresourceRange const subresourceRange {
+			.aspectMask     = vk::ImageAspectFlagBits::eColor,
+			.baseMipLevel   = 0,
+			.levelCount     = mipLevelCount,
+			.baseArrayLayer = 0,
+			.layerCount     = 1
+		};
+		auto view {
+			vk::raii::ImageView(
+				*mpDevice,
+				vk::ImageViewCreateInfo {
+					.image            = *imageHandle,
+					.viewType         =  vk::ImageViewType::e2D,
+					.format           =  format,
+					.subresourceRange =  subresourceRange
+				}
+			)
+		};
+		
+		// NOTE: Written once up front; the image is in `eShaderReadOnlyOptimal` layout by the time a draw samples it
+		//       since uploads are flushed to the graphics queue ahead of the frame that enqueued them.
+		auto const sampler { mpSamplerCache->get( samplerCreateInfo ) };
+		vk::raii::DescriptorSets descriptorSets(
+			*mpDevice,
+			vk::DescriptorSetAllocateInfo {
+				.descriptorPool     = **mpTextureDescriptorPool,
+				.descriptorSetCount =   1,
+				.pSetLayouts        = &**mpTextureSetLayout
+			}
+		); // NOTE: throws once `kMaxTextureCount` textures are alive
+		vk::DescriptorImageInfo const imageInfo {
+			.sampler     =  sampler,
+			.imageView   = *view,
+			.imageLayout =  vk::ImageLayout::eShaderReadOnlyOptimal
+		};
+		mpDevice->updateDescriptorSets(
+			vk::WriteDescriptorSet {
+				.dstSet          = *descriptorSets.front(),
+				.dstBinding      =  0,
+				.dstArrayElement =  0,
+				.descriptorCount =  1,
+				.descriptorType  =  vk::DescriptorType::eCombinedImageSampler,
+				.pImageInfo      = &imageInfo
+			},
+			{}
+		);
+		
+		std::vector<vk::BufferImageCopy> regions;
+		regions.reserve( levelOffsets.size() );
+		for ( u32 level{0}; level < levelOffsets.size(); ++level ) {
+			auto const levelExtent { getLevelExtent( extent, level ) };
+			regions.push_back(
+				vk::BufferImageCopy {
+					.bufferOffset      = levelOffsets[level],
+					.bufferRowLength   = 0, // i.e. tightly packed
+					.bufferImageHeight = 0, // ditto
+					.imageSubresource  = vk::ImageSubresourceLayers {
+					                        .aspectMask     = vk::ImageAspectFlagBits::eColor,
+					                        .mipLevel       = level,
+					                        .baseArrayLayer = 0,
+					                        .layerCount     = 1
+					                     },
+					.imageOffset       = vk::Offset3D { 0, 0, 0 },
+					.imageExtent       = vk::Extent3D { .width = levelExtent.width, .height = levelExtent.height, .depth = 1 }
+				}
+			);
+		}
+		auto const uploadTicket { uploadImage( data, *imageHandle, subresourceRange, std::move( regions ), mipGeneration ) };
+		return std::make_unique<Texture>(
+			Image { std::move(imageAllocation), std::move(imageHandle) },
+			std::move( view ),
+			sampler,
+			std::move( descriptorSets.front() ),
+			extent,
+			format,
+			mipLevelCount,
+			uploadTicket
+		);
+	} // end-of-function: Renderer::makeTextureFromLevels
+	
+	
+	
+	void
+	Renderer::makeTextureDescriptorPool()
+	{
+		spdlog::info( "Creating the texture descriptor pool..." );
+		
+		// pre-condition(s):
+		//   shouldn't be null unless the function is called in the wrong order:
+		assert( mpDevice != nullptr );
+		
+		vk::DescriptorPoolSize const poolSize {
+			.type            = vk::DescriptorType::eCombinedImageSampler,
+			.descriptorCount = kMaxTextureCount
+		};
+		mpTextureDescriptorPool = std::make_unique<vk::raii::DescriptorPool>(
+			*mpDevice,
+			vk::DescriptorPoolCreateInfo {
+				.flags         =  vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet, // each texture frees its own set
+				.maxSets       =  kMaxTextureCount,
+				.poolSizeCount =  1,
+				.pPoolSizes    = &poolSize
+			}
+		);
+	} // end-of-function: Renderer::makeTextureDescriptorPool
+	
+	
+	
+	void
+	Renderer::makeDefaultTexture()
+	{
+		spdlog::info( "Creating the default texture..." );
+		
+		// NOTE: a checkerboard of white and light grey tiles, so that the vertex colours still come through
+		std::vector<std::byte> pixels( kDefaultTextureSize * kDefaultTextureSize * 4 );
+		for ( u32 y{0}; y < kDefaultTextureSize; ++y ) {
+			for ( u32 x{0}; x < kDefaultTextureSize; ++x ) {
+				bool const isLight { (x / kDefaultTextureTileSize + y / kDefaultTextureTileSize) % 2 == 0 };
+				auto *pTexel { &pixels[ (y * kDefaultTextureSize + x) * 4 ] };
+				pTexel[0] = pTexel[1] = pTexel[2] = isLight ? std::byte { 0xFF } : std::byte { 0xC0 };
+				pTexel[3] = std::byte { 0xFF };
+			}
+		}
+		mpDefaultTexture = makeTexture( pixels, vk::Extent2D { .width = kDefaultTextureSize, .height = kDefaultTextureSize } );
+	} // end-of-function: Renderer::makeDefaultTexture
+	
+	
+	
+	[[nodiscard]] bool
+	Renderer::isTextureReady( Texture const &texture )
+	{
+		assert( mpUploadService != nullptr );
+		return mpUploadService->isComplete( texture.getUploadTicket() );
+	} // end-of-function: Renderer::isTextureReady
+	
+	
+	
+	[[nodiscard]] Renderer::RecordingStats const &
+	Renderer::getRecordingStats() const noexcept
+	{
+		return mRecordingStats;
+	} // end-of-function: Renderer::getRecordingStats
+	
+	
+	
+	[[nodiscard]] GpuProfiler &
+	Renderer::getGpuProfiler() noexcept
+	{
+		assert( mpGpuProfiler != nullptr );
+		return *mpGpuProfiler;
+	} // end-of-function: Renderer::getGpuProfiler
+	
+	
+	
+	[[nodiscard]] AssetPackage const *
+	Renderer::getAssetPackage() const noexcept
+	{
+		return mpAssetPackage.get();
+	} // end-of-function: Renderer::getAssetPackage
+	
+	
+	
+	[[nodiscard]] RendererConfig const &
+	Renderer::getConfig() const noexcept
+	{
+		return mConfig;
+	} // end-of-function: Renderer::getConfig
+	
+	
+	
+	void
+	Renderer::setConfig( RendererConfig const &config )
+	{
+		config.validate();
+		mPendingConfig = config;
+	} // end-of-function: Renderer::setConfig
+	
+	
+	
+	[[nodiscard]] Renderer::FrameTimings const &
+	Renderer::getFrameTimings() const noexcept
+	{
+		return mFrameTimings;
+	} // end-of-function: Renderer::getFrameTimings
+	
+	
+	
+	[[nodiscard]] Renderer::LatencyStats const &
+	Renderer::getLatencyStats() const noexcept
+	{
+		return mLatencyStats;
+	} // end-of-function: Renderer::getLatencyStats
+	
+	
+	
+	[[nodiscard]] DeletionQueue::Stats
+	Renderer::getDeletionStats() const noexcept
+	{
+		assert( mpDeletionQueue != nullptr );
+		return mpDeletionQueue->getStats();
+	} // end-of-function: Renderer::getDeletionStats
+	
+	
+	
+	void
+	Renderer::beginFrame()
+	{
+		if ( mHasBegunFrame ) [[unlikely]]
+			return;
+		PROFILE_FUNCTION();
+		mFrameTimings = {};
+		ScopedTimer const frameTimer { mFrameTimings.totalMs };
+		if ( mPendingConfig ) [[unlikely]]
+			applyPendingConfig();
+		auto const frame = static_cast<u32>( mCurrentFrame % mConfig.framesInFlight );
+		
+		// the frame slot is free once the frame that last used it (`framesInFlight` ago) has completed:
+		if ( mCurrentFrame >= mConfig.framesInFlight ) [[likely]] {
+			PROFILE_ZONE( "wait for frame slot" );
+			ScopedTimer const waitTimer { mFrameTimings.waitMs };
+			waitForFrames( mCurrentFrame - mConfig.framesInFlight + 1 );
+		}
+		if ( not mpDeletionQueue->isEmpty() ) // destroy retired resources that are no longer in use
+			mpDeletionQueue->collect( mpFrameTimeline->getCompletedFrameCount(), mCurrentFrame );
+		mpGpuProfiler->beginFrame( frame, mCurrentFrame ); // collects the timestamps of the slot's previous frame
+		auto &frameContext { mFrameContexts[frame] };
+		frameContext.primary.pCommandPool->reset( {} ); // recycles the frame's command buffer memory in bulk
+		for ( auto &secondary: frameContext.secondaries )
+			secondary.pCommandPool->reset( {} );
+		mpUploadService->collect();         // recycle completed upload batches (and their staging buffers)
+		mpStagingRing->beginFrame( frame ); // the frame's previous staging data is no longer in use
+		mpUniformRing->beginFrame( frame ); // ditto for its uniform data
+		
+		if ( isFramePacingEnabled() ) {
+			PROFILE_ZONE( "frame pacing" );
+			ScopedTimer const pacingTimer { mFrameTimings.pacingMs };
+			mFramePacer.waitForDeadline( mpGpuProfiler->getLastFrameMs() );
 		}
+		mHasBegunFrame = true;
+	} // end-of-function: Renderer::beginFrame
+	
+	
+	
+	void
+	Renderer::operator()()
+	{
+		PROFILE_ZONE( "frame" );
+		beginFrame(); // NOTE: no-op if already called for this frame (e.g. when the last call dropped it)
+		ScopedTimer const frameTimer { mFrameTimings.totalMs };
+		auto const frame = static_cast<u32>( mCurrentFrame % mConfig.framesInFlight );
+		auto &frameContext { mFrameContexts[frame] };
+		LOG_TRACE( "[draw]: Drawing frame #{} (@{})...", mCurrentFrame, frame );
 		
 		u32 acquiredIndex;
-		try {
+		if ( isHeadless() ) [[unlikely]] {
+			acquiredIndex = frame; // one offscreen image per frame slot
+		}
+		else try {
+			PROFILE_ZONE( "acquire image" );
+			ScopedTimer const acquireTimer { mFrameTimings.acquireMs };
 			auto const [result, index] {
 				mpSwapchain->acquireNextImage( kDrawWaitTimeout, *mImageAvailable[frame] )
 			};
@@ -1508,6 +3065,7 @@ namespace gfx {
 		}
 		catch ( vk::OutOfDateKHRError const & ) {
 			spdlog::info( "Swapchain out-of-date!" );
+			mDrawList.clear(); // the frame is dropped; game code enqueues anew every frame
 			generateDynamicState(); // likely having to handle a screen resize...
 			return;
 		}
@@ -1516,29 +3074,77 @@ namespace gfx {
 			throw std::runtime_error { "Failed to acquire swapchain image!" };
 		}	
 		
-		try {
-			mpDevice->resetFences( *mFencesInFlight[frame] );
-			vk::PipelineStageFlags const waitDstStages ( vk::PipelineStageFlagBits::eColorAttachmentOutput );
-			mpGraphicsQueue->submit(
-				vk::SubmitInfo {
-					.waitSemaphoreCount   = 1,
-					.pWaitSemaphores      = &*mImageAvailable[frame],
-					.pWaitDstStageMask    = &waitDstStages,
-					.commandBufferCount   = 1,
-					.pCommandBuffers      = &*(*mpCommandBuffers)[acquiredIndex],
-					.signalSemaphoreCount = 1,
-					.pSignalSemaphores    = &*mImagePresentable[frame], 
-				},
-				*mFencesInFlight[frame]
-			);
+		auto &commandBuffer { (*frameContext.primary.pCommandBuffers)[0] };
+		{
+			PROFILE_ZONE( "record commands" );
+			auto const recordingStart { std::chrono::steady_clock::now() };
+			auto const frameUniforms { allocateFrameUniforms( frame ) };
+			bool const wasParallel   { recordCommandBuffer( frameContext, frameUniforms, acquiredIndex, frame ) };
+			if ( mIsReadbackRequested ) [[unlikely]] { // NOTE: recorded along with the frame
+				mPendingReadbackFrame = mCurrentFrame;
+				mIsReadbackRequested  = false;
+			}
+			auto const recordingMs {
+				std::chrono::duration<f64,std::milli>( std::chrono::steady_clock::now() - recordingStart ).count()
+			};
+			mRecordingStats.frameCount         += 1;
+			mRecordingStats.parallelFrameCount += wasParallel ? 1 : 0;
+			mRecordingStats.drawCount          += mDrawList.getSize();
+			mRecordingStats.totalMs            += recordingMs;
+			mRecordingStats.maxMs               = std::max( mRecordingStats.maxMs, recordingMs );
+			mFrameTimings.recordMs              = recordingMs;
+			mDrawList.clear();
+			if ( mRecordingStats.frameCount >= kRecordingStatsInterval ) [[unlikely]] {
+				reportRecordingStats();
+				reportStagingStats();
+			}
 		}
-		catch ( vk::SystemError const &e ) {
-			spdlog::error( "Encountered system error: \"{}\"!", e.what() );
-			throw std::runtime_error { "Failed to submit draw command buffer!" };
+		
+		// submit any uploads enqueued since the last frame in one batch ahead of the draw:
+		{
+			ScopedTimer const submitTimer { mFrameTimings.submitMs };
+			mpUploadService->flush();
+			
+			try {
+				PROFILE_ZONE( "submit" );
+				// NOTE: offscreen images are neither acquired nor presented, so there's nothing to wait on or signal
+				bool const usesSwapchain { not isHeadless() };
+				vk::PipelineStageFlags const waitDstStages ( vk::PipelineStageFlagBits::eColorAttachmentOutput );
+				mpFrameTimeline->submit(
+					*mpGraphicsQueue,
+					vk::SubmitInfo {
+						.waitSemaphoreCount   = usesSwapchain ? 1u : 0u,
+						.pWaitSemaphores      = usesSwapchain ? &*mImageAvailable[frame] : nullptr,
+						.pWaitDstStageMask    = usesSwapchain ? &waitDstStages           : nullptr,
+						.commandBufferCount   = 1,
+						.pCommandBuffers      = &*commandBuffer,
+						.signalSemaphoreCount = usesSwapchain ? 1u : 0u,
+						.pSignalSemaphores    = usesSwapchain ? &*mImagePresentable[frame] : nullptr, 
+					},
+					mCurrentFrame
+				);
+				mpStagingRing->endFrame( frame ); // staging data written up until now is released with this frame
+				mpGpuProfiler->markSubmitted();
+				mFramePacer.markSubmitted();
+				// NOTE: Only cleared once submitted; a frame dropped before that (i.e. on an out-of-date swapchain)
+				//       is retried without beginning it again (which would e.g. pace it twice).
+				mHasBegunFrame = false;
+			}
+			catch ( vk::SystemError const &e ) {
+				spdlog::error( "Encountered system error: \"{}\"!", e.what() );
+				throw std::runtime_error { "Failed to submit draw command buffer!" };
+			}
+		}
+		
+		if ( isHeadless() ) [[unlikely]] {
+			++mCurrentFrame;
+			return;
 		}
 		
 		vk::Result presentResult;
 		try {
+			PROFILE_ZONE( "present" );
+			ScopedTimer const presentTimer { mFrameTimings.presentMs };
 			presentResult = mpPresentQueue->presentKHR(
 				vk::PresentInfoKHR {
 					.waitSemaphoreCount = 1,
@@ -1550,27 +3156,179 @@ namespace gfx {
 			);
 		}
 		catch ( vk::OutOfDateKHRError const & ) {
-			/* do nothing */
+			presentResult = vk::Result::eErrorOutOfDateKHR;
 		}
 		catch ( vk::SystemError const &e ) {
 			spdlog::error( "Encountered system error: \"{}\"!", e.what() );
 			throw std::runtime_error { "Failed to present swapchain image!" };
 		}
 		
-		if ( mShouldRemakeSwapchain
+		// NOTE: Measured until the present call returns; the compositor and scan-out add some more on top
+		//       which would need `VK_KHR_present_wait` (or `VK_GOOGLE_display_timing`) to observe.
+		mFramePacer.markPresented();
+		// NOTE: frames that didn't consume any input events have no latency to measure
+		if ( auto const inputTime { mpWindow->takeOldestPolledEventTime() } ) {
+			auto const latencyMs {
+				std::chrono::duration<f64,std::milli>( std::chrono::steady_clock::now() - *inputTime ).count()
+			};
+			mFrameTimings.inputToPresentMs  = latencyMs;
+			mLatencyStats.frameCount       += 1;
+			mLatencyStats.totalMs          += latencyMs;
+			mLatencyStats.maxMs             = std::max( mLatencyStats.maxMs, latencyMs );
+			if ( mLatencyStats.frameCount >= kLatencyStatsInterval ) [[unlikely]]
+				reportLatencyStats();
+		}
+		
+		// NOTE: the frame has been submitted, so it's counted before any remake retires the state it used
+		++mCurrentFrame;
+		
+		// NOTE: the flag is cleared before the remake so that a resize during it isn't lost
+		if ( mShouldRemakeSwapchain.exchange( false, std::memory_order_acq_rel )
 //		or   presentResult == vk::Result::eSuboptimalKHR // TEMP disable
 		or   presentResult == vk::Result::eErrorOutOfDateKHR )
 		{
 			spdlog::info( "Swapchain out-of-date or window resized!" );
-			mShouldRemakeSwapchain = false;
 			generateDynamicState();
-			return; // TODO: verify that this is needed
 		}
-		
-		++mCurrentFrame;
 	} // end-of-function: Renderer::operator()
 	
 	
 	
+	void
+	Renderer::requestReadback()
+	{
+		if ( not isHeadless() ) [[unlikely]]
+			throw std::runtime_error { "Readbacks are only supported in headless mode!" };
+		if ( mpReadbackBuffer == nullptr ) [[unlikely]]
+			makeReadbackBuffer();
+		// NOTE: a readback that is still pending gets superseded (they share the same buffer)
+		mIsReadbackRequested  = true;
+		mPendingReadbackFrame.reset();
+	} // end-of-function: Renderer::requestReadback
+	
+	
+	
+	[[nodiscard]] std::optional<Renderer::Readback>
+	Renderer::pollReadback()
+	{
+		if ( not mPendingReadbackFrame.has_value() )
+			return std::nullopt;
+		if ( not mpFrameTimeline->hasCompleted( *mPendingReadbackFrame + 1 ) )
+			return std::nullopt;
+		return takeReadback();
+	} // end-of-function: Renderer::pollReadback
+	
+	
+	
+	[[nodiscard]] Renderer::Readback
+	Renderer::waitReadback()
+	{
+		if ( not mPendingReadbackFrame.has_value() ) [[unlikely]]
+			throw std::runtime_error { "No readback is pending; request one and render a frame first!" };
+		waitForFrames( *mPendingReadbackFrame + 1 );
+		return takeReadback();
+	} // end-of-function: Renderer::waitReadback
+	
+	
+	
+	void
+	Renderer::makeReadbackBuffer()
+	{
+		spdlog::info( "Creating a readback buffer..." );
+		
+		// pre-condition(s):
+		assert( isHeadless() );
+		assert( mSurfaceFormat.format == kHeadlessColorFormat );
+		
+		vk::DeviceSize const size { vk::DeviceSize{ mSurfaceExtent.width } * mSurfaceExtent.height * 4 }; // RGBA8
+		// NOTE: cached memory makes the CPU-side copy a lot faster, but isn't guaranteed to exist:
+		try {
+			mpReadbackBuffer = makeBuffer(
+				vk::BufferUsageFlagBits::eTransferDst,
+				size,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent | vk::MemoryPropertyFlagBits::eHostCached
+			);
+		}
+		catch ( std::runtime_error const & ) {
+			spdlog::info( "... no host cached memory; falling back on uncached memory" );
+			mpReadbackBuffer = makeBuffer(
+				vk::BufferUsageFlagBits::eTransferDst,
+				size,
+				vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+			);
+		}
+	} // end-of-function: Renderer::makeReadbackBuffer
+	
+	
+	
+	void
+	Renderer::recordReadback( vk::raii::CommandBuffer &commandBuffer, u32 const imageIndex ) const
+	{
+		// pre-condition(s):
+		assert( mpReadbackBuffer != nullptr );
+		assert( imageIndex < mImages.size() );
+		
+		// NOTE: the render pass has already transitioned the image into eTransferSrcOptimal, and its dependency on
+		//       EXTERNAL orders that (and the color writes) before this copy (see: `makeRenderPass`)
+		commandBuffer.copyImageToBuffer(
+			static_cast<vk::Image>( mImages[imageIndex] ),
+			vk::ImageLayout::eTransferSrcOptimal,
+			*mpReadbackBuffer->handle,
+			vk::BufferImageCopy {
+				.bufferOffset      = 0,
+				.bufferRowLength   = 0, // tightly packed
+				.bufferImageHeight = 0, // ditto
+				.imageSubresource  = vk::ImageSubresourceLayers {
+				                      .aspectMask     = vk::ImageAspectFlagBits::eColor,
+				                      .mipLevel       = 0,
+				                      .baseArrayLayer = 0,
+				                      .layerCount     = 1
+				                   },
+				.imageOffset       = vk::Offset3D { .x = 0, .y = 0, .z = 0 },
+				.imageExtent       = vk::Extent3D { .width = mSurfaceExtent.width, .height = mSurfaceExtent.height, .depth = 1 }
+			}
+		);
+		// make the copy visible to the host once the frame has completed:
+		commandBuffer.pipelineBarrier(
+			vk::PipelineStageFlagBits::eTransfer,
+			vk::PipelineStageFlagBits::eHost,
+			{},
+			nullptr,
+			vk::BufferMemoryBarrier {
+				.srcAccessMask       = vk::AccessFlagBits::eTransferWrite,
+				.dstAccessMask       = vk::AccessFlagBits::eHostRead,
+				.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+				.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+				.buffer              = *mpReadbackBuffer->handle,
+				.offset              = 0,
+				.size                = VK_WHOLE_SIZE
+			},
+			nullptr
+		);
+	} // end-of-function: Renderer::recordReadback
+	
+	
+	
+	[[nodiscard]] Renderer::Readback
+	Renderer::takeReadback()
+	{
+		// pre-condition(s):
+		assert( mPendingReadbackFrame.has_value() );
+		assert( mpReadbackBuffer != nullptr );
+		assert( mpReadbackBuffer->allocation.getMappedData() != nullptr );
+		
+		Readback result {
+			.frame  = *mPendingReadbackFrame,
+			.extent =  mSurfaceExtent,
+			.format =  mSurfaceFormat.format,
+			.pixels =  std::vector<u8>( vk::DeviceSize{ mSurfaceExtent.width } * mSurfaceExtent.height * 4 )
+		};
+		std::memcpy( result.pixels.data(), mpReadbackBuffer->allocation.getMappedData(), result.pixels.size() );
+		mPendingReadbackFrame.reset();
+		return result;
+	} // end-of-function: Renderer::takeReadback
+	
+	
+	
 } // end-of-namespace: gfx
 // EOF
@@ -3,30 +3,149 @@
 #define RENDERER_HPP_YBLYHOXN
 
 #include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Renderer/UploadService.hpp"
+#include "MyTemplate/Renderer/StagingRing.hpp"
+#include "MyTemplate/Renderer/UniformRing.hpp"
+#include "MyTemplate/Renderer/Uniforms.hpp"
+#include "MyTemplate/Renderer/DrawList.hpp"
+#include "MyTemplate/Renderer/FrameTimeline.hpp"
+#include "MyTemplate/Renderer/DeletionQueue.hpp"
+#include "MyTemplate/Renderer/GpuProfiler.hpp"
+#include "MyTemplate/Renderer/RendererConfig.hpp"
+#include "MyTemplate/Renderer/FramePacer.hpp"
+#include "MyTemplate/Renderer/SamplerCache.hpp"
+#include "MyTemplate/Renderer/Texture.hpp"
+#include "MyTemplate/Renderer/GeometryBuffer.hpp"
+#include "MyTemplate/Renderer/Primitives.hpp"
+#include "MyTemplate/Common/WorkerPool.hpp"
+#include "MyTemplate/Common/AssetPackage.hpp"
 
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_raii.hpp>
 
 #include <memory>
 #include <vector>
+#include <span>
+#include <cstddef>
+#include <optional>
+#include <atomic>
+#include <filesystem>
+#include <string_view>
 
 namespace gfx {
 	class Renderer final {
 		public:
-			Renderer();
+			// CPU cost of recording the frame command buffers, accumulated since the last report:
+			struct RecordingStats final {
+				u64 frameCount         { 0 };
+				u64 parallelFrameCount { 0 }; // frames recorded with secondary command buffers
+				u64 drawCount          { 0 };
+				f64 totalMs            { 0 };
+				f64 maxMs              { 0 };
+			}; // end-of-struct: Renderer::RecordingStats
+			
+			// CPU time spent in each stage of the most recent frame (`beginFrame` + `operator()`):
+			struct FrameTimings final {
+				f64 waitMs           { 0 }; // for the frame slot to be free (i.e. throttled by the GPU)
+				f64 pacingMs         { 0 }; // sleeping until the predicted deadline (see `FramePacer`)
+				f64 acquireMs        { 0 };
+				f64 recordMs         { 0 };
+				f64 submitMs         { 0 }; // including the upload flush
+				f64 presentMs        { 0 };
+				f64 totalMs          { 0 };
+				f64 inputToPresentMs { 0 }; // from when the oldest input event consumed for the frame arrived until the present call returned (0 if none or headless)
+			}; // end-of-struct: Renderer::FrameTimings
+			
+			// Input-to-present latency (see `FrameTimings::inputToPresentMs`) of the frames that consumed input, accumulated since the last report:
+			struct LatencyStats final {
+				u64 frameCount { 0 };
+				f64 totalMs    { 0 };
+				f64 maxMs      { 0 };
+			}; // end-of-struct: Renderer::LatencyStats
+			
+			// Copy of a rendered (headless) frame in host memory; pixels are tightly packed.
+			struct Readback final {
+				u64              frame;
+				vk::Extent2D     extent;
+				vk::Format       format;
+				std::vector<u8>  pixels;
+			}; // end-of-struct: Renderer::Readback
+			
+			explicit Renderer(
+				DisplayMode    const  displayMode    = DisplayMode::eWindowed,
+				RendererConfig const &config         = {},
+				vk::Extent2D   const  headlessExtent = { .width = 1280, .height = 720 } // ignored unless headless
+			);
 			~Renderer() noexcept;
-			Renderer(             Renderer const &  )          = delete;
-			Renderer(             Renderer       && ) noexcept = default;
-			Renderer & operator=( Renderer const &  )          = delete;
-			Renderer & operator=( Renderer       && ) noexcept = default;
+			Renderer(             Renderer const &  ) = delete;
+			Renderer(             Renderer       && ) = delete; // NOTE: the window refers back to `mShouldRemakeSwapchain`
+			Renderer & operator=( Renderer const &  ) = delete;
+			Renderer & operator=( Renderer       && ) = delete;
 			
-			[[nodiscard]] Window const & getWindow() const;
+			[[nodiscard]] bool           isHeadless() const noexcept;
+			[[nodiscard]] Window const & getWindow() const; // NOTE: there's no window in headless mode
 			[[nodiscard]] Window       & getWindow();
-			void operator()(); // renders
+			[[nodiscard]] DrawList     & getDrawList() noexcept; // enqueue the frame's draws here before rendering
+			[[nodiscard]] DrawCommand    getRectangleDrawCommand() const noexcept;
+			// parses the glTF files (see: MeshFile) on the worker threads and stages every mesh in them for upload into
+			// the shared geometry buffer (batched with the frame's other uploads); returns the mesh IDs in file order:
+			[[nodiscard]] std::vector<MeshId> loadMeshes( std::span<std::filesystem::path const> paths );
+			[[nodiscard]] DrawCommand         getMeshDrawCommand( MeshId const ) const noexcept;
+			[[nodiscard]] bool                isMeshReady( MeshId const ); // i.e. its upload has completed
+			void                         setCamera( CameraUniforms const & ) noexcept; // used from the next rendered frame on
+			// stages the tightly packed pixels of the first mip level for upload (batched with the frame's other uploads);
+			// the rest of the mip chain is generated on the GPU if the format supports it (throws if the size of the pixels
+			// doesn't match the extent and format):
+			[[nodiscard]] std::unique_ptr<Texture> makeTexture(
+				std::span<std::byte const>         pixels,
+				vk::Extent2D                const  extent,
+				vk::Format                  const  format             = vk::Format::eR8G8B8A8Srgb,
+				vk::SamplerCreateInfo       const &sampler            = SamplerCache::kDefaultCreateInfo,
+				bool                        const  shouldGenerateMips = true
+			);
+			// loads the first of the texture files (see: TextureFile) in a format the device can sample, so pass them in
+			// order of preference (e.g. ASTC before BCn); if there's none, the first one in a format that can be decoded
+			// on the CPU is loaded and uploaded uncompressed:
+			[[nodiscard]] std::unique_ptr<Texture> loadTexture(
+				std::span<std::filesystem::path const>         candidatePaths,
+				vk::SamplerCreateInfo                  const  &sampler = SamplerCache::kDefaultCreateInfo
+			);
+			[[nodiscard]] bool           isTextureReady( Texture const & ); // i.e. its upload has completed
+			[[nodiscard]] RecordingStats const & getRecordingStats() const noexcept;
+			[[nodiscard]] FrameTimings   const & getFrameTimings()   const noexcept;
+			[[nodiscard]] LatencyStats   const & getLatencyStats()   const noexcept;
+			[[nodiscard]] RendererConfig const & getConfig()         const noexcept; // excluding pending changes
+			// validates the config (throws if invalid) and applies it at the start of the next frame;
+			// only the swapchain and its semaphores are remade, and only if affected:
+			void setConfig( RendererConfig const & );
+			[[nodiscard]] DeletionQueue::Stats   getDeletionStats()  const noexcept;
+			[[nodiscard]] GpuProfiler          & getGpuProfiler()          noexcept;
+			// e.g. to stage meshes or textures straight from the mapping; null if assets are loaded per file:
+			[[nodiscard]] AssetPackage const   * getAssetPackage()   const noexcept;
+			// destroys the resource (e.g. a buffer, image, view, or pipeline) once every frame submitted so far has completed:
+			template <typename T>
+			void retire( T &&resource );
+			// Waits for the frame slot (and, with minimal-latency frame pacing, sleeps until the predicted deadline).
+			// NOTE: Optional; call it *before* sampling input so the frame is built from the freshest input
+			//       possible. Otherwise `operator()` calls it, i.e. after the input has been sampled.
+			void beginFrame();
+			void operator()(); // renders (and clears) the enqueued draws
+			// headless only; the next rendered frame is copied into host memory:
+			void                                  requestReadback();
+			[[nodiscard]] std::optional<Readback> pollReadback(); // empty until the frame has completed
+			[[nodiscard]] Readback                waitReadback();
 			
 		private:
+			// uploads that didn't fit in the staging ring (see: `countStagingFallback`):
+			struct StagingStats final {
+				u64            fallbackCount      { 0 }; // since the last report
+				vk::DeviceSize fallbackSize       { 0 }; // ditto
+				u64            totalFallbackCount { 0 };
+			}; // end-of-struct: Renderer::StagingStats
+			
 			void                                                    enableValidationLayers();
 			void                                                    enableInstanceExtensions();
+			[[nodiscard]] std::span<char const * const>             getRequiredDeviceExtensions() const noexcept;
 			[[nodiscard]] bool                                      meetsDeviceExtensionRequirements( vk::raii::PhysicalDevice const & ) const;
 			[[nodiscard]] u32                                       calculateScore(                   vk::raii::PhysicalDevice const & ) const;
 			void                                                    makeVkContext();
@@ -35,72 +154,185 @@ namespace gfx {
 			void                                                    maybeMakeDebugMessenger();
 			void                                                    selectQueueFamilies();
 			void                                                    makeLogicalDevice();
+			[[nodiscard]] bool                                      isDeviceExtensionEnabled( char const *extensionName ) const;
 			[[nodiscard]] std::unique_ptr<vk::raii::Queue>          makeQueue( u32 const queueFamilyIndex, u32 const queueIndex );
 			void                                                    makeQueues();
+			void                                                    openAssetPackage(); // if there is one
 			void                                                    makeCommandPools();
-			[[nodiscard]] std::unique_ptr<vk::raii::CommandBuffers> makeCommandBuffers( vk::CommandBufferLevel const, u32 const bufferCount );
+			[[nodiscard]] std::unique_ptr<vk::raii::CommandBuffers> makeCommandBuffers( vk::raii::CommandPool const &, vk::CommandBufferLevel const, u32 const bufferCount );
 			void                                                    selectSurfaceFormat();
 			void                                                    selectSurfaceExtent();
 			void                                                    selectPresentMode() noexcept;
 			void                                                    selectFramebufferCount() noexcept;
+			void                                                    selectDepthFormat();
 			void                                                    generateDynamicState();
-			void                                                    makeSwapchain();
-			[[nodiscard]] std::unique_ptr<vk::raii::ShaderModule>   makeShaderModuleFromBinary( std::vector<char> const &shaderBinary ) const;
-			[[nodiscard]] std::unique_ptr<vk::raii::ShaderModule>   makeShaderModuleFromFile( std::string const &shaderSpirvBytecodeFilename ) const;
-			void                                                    makeGraphicsPipelineLayout();
+			void                                                    makeSwapchain( vk::SwapchainKHR const oldSwapchain = {} );
+			void                                                    makeOffscreenImages();
+			void                                                    makeImageViews();
+			void                                                    makeDepthImages(); // one per frame slot
+			[[nodiscard]] std::unique_ptr<vk::raii::ShaderModule>   makeShaderModuleFromBinary( std::span<std::byte const> shaderBinary ) const;
+			[[nodiscard]] std::unique_ptr<vk::raii::ShaderModule>   makeShaderModuleFromAsset( std::string_view const assetName ) const; // from the package if there is one
+			void                                                    makeGraphicsPipelineLayout(); // including the texture set layout
+			void                                                    makeUniformRing( vk::DeviceSize const regionSize );
 			void                                                    makeRenderPass(); // TODO: rename?
 			void                                                    makeGraphicsPipeline();
-			[[nodiscard]] u32                                       findMemoryTypeIndex( u32 const typeFilter, vk::MemoryPropertyFlags const ) const;
+			void                                                    makePipelineCache();
+			void                                                    savePipelineCache() const;
 			[[nodiscard]] std::unique_ptr<Buffer>                   makeBuffer( vk::BufferUsageFlags const, vk::DeviceSize const, vk::MemoryPropertyFlags const );
-			void                                                    copy( Buffer const &src, Buffer &dst, vk::DeviceSize const );
-			void                                                    makeVertexBuffer();
-			void                                                    makeIndexBuffer();
+			UploadTicket                                            copy( std::unique_ptr<Buffer> src, Buffer const &dst, vk::DeviceSize const, vk::DeviceSize const dstOffset = 0 );
+			void                                                    makeStagingRing();
+			UploadTicket                                            upload( void const *pData, vk::DeviceSize const, Buffer const &dst, vk::DeviceSize const dstOffset = 0 );
+			// the regions' buffer offsets are relative to the start of the data:
+			UploadTicket                                            uploadImage( std::span<std::byte const>, vk::Image const dst, vk::ImageSubresourceRange const &, std::vector<vk::BufferImageCopy> regions, std::optional<MipGeneration> const = std::nullopt );
+			// the levels are tightly packed in the data (starting at the given offsets), except for the generated ones:
+			[[nodiscard]] std::unique_ptr<Texture>                  makeTextureFromLevels( std::span<std::byte const>, vk::Extent2D const, vk::Format const, u32 const mipLevelCount, std::span<vk::DeviceSize const> levelOffsets, std::optional<MipGeneration> const, vk::SamplerCreateInfo const & );
+			void                                                    makeTextureDescriptorPool();
+			void                                                    makeDefaultTexture();
+			void                                                    makeGeometryBuffer(); // including the rectangle mesh
+			MeshId                                                  addMesh( std::span<Vertex2D const>, std::span<u32 const> indices ); // throws if the geometry buffer is full
 			void                                                    makeFramebuffers();
-			void                                                    makeCommandBuffers();
+			[[nodiscard]] u32                                       getFramebufferIndex( u32 const imageIndex, u32 const frameSlot ) const noexcept;
+			struct FrameContext;
+			struct FrameUniforms;
+			[[nodiscard]] FrameUniforms                             allocateFrameUniforms( u32 const frameSlot ); // writes the camera; reserves space for the draws
+			[[nodiscard]] bool                                      recordCommandBuffer( FrameContext &, FrameUniforms const &, u32 const imageIndex, u32 const frameSlot ) const; // true if recorded in parallel
+			void                                                    recordPipelineState( vk::raii::CommandBuffer & ) const;
+			void                                                    recordDraws( vk::raii::CommandBuffer &, FrameUniforms const &, std::span<DrawCommand const>, u64 const firstDrawIndex ) const;
+			void                                                    reportRecordingStats();
+			void                                                    reportLatencyStats();
+			void                                                    countStagingFallback( vk::DeviceSize const size ); // i.e. an upload that didn't fit in the staging ring
+			void                                                    reportStagingStats();
+			[[nodiscard]] bool                                      isFramePacingEnabled() const noexcept;
+			void                                                    reportDeletionStats() const;
 			void                                                    makeSyncPrimitives();
+			void                                                    waitForFrames( u64 const frameCount ); // i.e. until the first `frameCount` frames have completed
+			void                                                    applyPendingConfig();
+			void                                                    makeReadbackBuffer();
+			void                                                    recordReadback( vk::raii::CommandBuffer &, u32 const imageIndex ) const;
+			[[nodiscard]] Readback                                  takeReadback();
+			
+			// Dynamic state replaced by a swapchain remake that may still be referenced by frames in flight.
+			// NOTE: declaration order is very important here! (it dictates the order of destruction)
+			struct RetiredDynamicState final {
+				std::unique_ptr<vk::raii::RenderPass>     pRenderPass;    // only set if the surface format changed
+				std::unique_ptr<vk::raii::Pipeline>       pPipeline;      // only set if the surface format changed
+				std::unique_ptr<vk::raii::SwapchainKHR>   pSwapchain;
+				std::vector<vk::raii::ImageView>          imageViews;
+				std::vector<Image>                        depthImages;
+				std::vector<vk::raii::ImageView>          depthImageViews;
+				std::vector<vk::raii::Framebuffer>        framebuffers;
+			}; // end-of-struct: Renderer::RetiredDynamicState
+			
+			// Command pool with a single command buffer; never used by more than one thread at a time.
+			// NOTE: declaration order is very important here! (it dictates the order of destruction)
+			struct CommandContext final {
+				std::unique_ptr<vk::raii::CommandPool>    pCommandPool;
+				std::unique_ptr<vk::raii::CommandBuffers> pCommandBuffers;
+			}; // end-of-struct: Renderer::CommandContext
+			
+			// Where a frame's uniform data went in the uniform ring; draw #i reads its object uniforms at `objectsOffset + i * objectStride`.
+			struct FrameUniforms final {
+				vk::DescriptorSet  descriptorSet;
+				u32                cameraOffset;
+				u32                objectsOffset;
+				u32                objectStride;
+				void              *pObjects;      // mapped pointer to the first draw's object uniforms
+			}; // end-of-struct: Renderer::FrameUniforms
+			
+			// Per frame in flight; the pools are reset in bulk once the frame has completed.
+			struct FrameContext final {
+				CommandContext              primary;    // re-recorded every frame
+				std::vector<CommandContext> secondaries; // one per worker; each records a slice of the draw list
+			}; // end-of-struct: Renderer::FrameContext
 			
 			// NOTE: declaration order is very important here! (it dictates the order of destruction)
+			DisplayMode                                          mDisplayMode                     ;
+			vk::Extent2D                                         mHeadlessExtent                  ;
+			RendererConfig                                       mConfig                          ;
+			std::optional<RendererConfig>                        mPendingConfig                   ; // applied at the start of the next frame
 			std::vector<char const *>                            mValidationLayers                ;
 			std::vector<char const *>                            mInstanceExtensions              ;
-			std::unique_ptr<GlfwInstance>                        mpGlfwInstance                   ;
+			std::vector<char const *>                            mDeviceExtensions                ;
+			u32                                                  mApiVersion                      ; // negotiated instance API version
+			std::unique_ptr<GlfwInstance>                        mpGlfwInstance                   ; // NOTE: null if headless
 			std::unique_ptr<vk::raii::Context>                   mpVkContext                      ;
 			std::unique_ptr<vk::raii::Instance>                  mpVkInstance                     ;
 			#if !defined( NDEBUG )
 				std::unique_ptr<vk::raii::DebugUtilsMessengerEXT> mpDebugMessenger                 ;
 			#endif
-			std::unique_ptr<Window>                              mpWindow                         ;
+			std::unique_ptr<Window>                              mpWindow                         ; // NOTE: null if headless
 			std::unique_ptr<vk::raii::PhysicalDevice>            mpPhysicalDevice                 ;
 			QueueFamilyIndices                                   mQueueFamilyIndices              ;
 			std::unique_ptr<vk::raii::Device>                    mpDevice                         ;
+			bool                                                 mHasTimelineSemaphores           ;
+			std::unique_ptr<Allocator>                           mpAllocator                      ; // NOTE: Must outlive all buffers and images!
+			std::unique_ptr<vk::raii::PipelineCache>             mpPipelineCache                  ;
+			u32                                                  mPipelineCreationCount           ;
+			u32                                                  mPipelineCacheHitCount           ;
 			std::unique_ptr<vk::raii::Queue>                     mpGraphicsQueue                  ;
 			std::unique_ptr<vk::raii::Queue>                     mpPresentQueue                   ;
 			std::unique_ptr<vk::raii::Queue>                     mpTransferQueue                  ;
-			std::unique_ptr<vk::raii::CommandPool>               mpGraphicsCommandPool            ;
-			std::unique_ptr<vk::raii::CommandPool>               mpTransferCommandPool            ;
+			std::unique_ptr<AssetPackage>                        mpAssetPackage                   ; // NOTE: null if assets are loaded per file
+			std::unique_ptr<WorkerPool>                          mpWorkerPool                     ;
+			std::vector<FrameContext>                            mFrameContexts                   ; // indexed by frame slot (`mCurrentFrame % mConfig.framesInFlight`)
+			std::unique_ptr<StagingRing>                         mpStagingRing                    ; // NOTE: Must outlive the upload service!
+			std::unique_ptr<UploadService>                       mpUploadService                  ; // NOTE: Must be deleted before allocator!
+			std::unique_ptr<SamplerCache>                        mpSamplerCache                   ; // NOTE: Must outlive all textures!
+			std::unique_ptr<vk::raii::DescriptorPool>            mpTextureDescriptorPool          ; // NOTE: Must outlive all textures!
+			std::unique_ptr<DeletionQueue>                       mpDeletionQueue                  ; // NOTE: Must be deleted before allocator!
+			std::unique_ptr<GpuProfiler>                         mpGpuProfiler                    ;
 			// dynamic:
 			vk::SurfaceFormatKHR                                 mSurfaceFormat                   ;
+			vk::Format                                           mDepthFormat                     ;
 			vk::SurfaceCapabilitiesKHR                           mSurfaceCapabilities             ;
 			vk::Extent2D                                         mSurfaceExtent                   ;
 			vk::PresentModeKHR                                   mPresentMode                     ;
 			u32                                                  mFramebufferCount                ;
-			std::unique_ptr<vk::raii::SwapchainKHR>              mpSwapchain                      ;
+			std::unique_ptr<vk::raii::SwapchainKHR>              mpSwapchain                      ; // NOTE: null if headless
+			std::vector<Image>                                   mOffscreenImages                 ; // NOTE: empty unless headless
 			std::vector<VkImage>                                 mImages                          ;
 			std::vector<vk::raii::ImageView>                     mImageViews                      ;
-			std::unique_ptr<Buffer>                              mpVertexBuffer                   ;
-			std::unique_ptr<Buffer>                              mpIndexBuffer                    ;
-			std::unique_ptr<vk::raii::CommandBuffers>            mpCommandBuffers                 ; // NOTE: Must be deleted before command pool!
+			std::vector<Image>                                   mDepthImages                     ; // indexed by frame slot
+			std::vector<vk::raii::ImageView>                     mDepthImageViews                 ; // indexed by frame slot
+			std::unique_ptr<GeometryBuffer>                      mpGeometryBuffer                 ; // shared by every mesh
+			MeshId                                               mRectangleMesh                   ;
+			std::unique_ptr<Texture>                             mpDefaultTexture                 ; // sampled by draws without a texture of their own (see: DrawCommand::textureSet)
 			std::unique_ptr<vk::raii::ShaderModule>              mpVertexShaderModule             ;
 			std::unique_ptr<vk::raii::ShaderModule>              mpFragmentShaderModule           ;
+			std::unique_ptr<vk::raii::DescriptorSetLayout>       mpDescriptorSetLayout            ;
+			std::unique_ptr<vk::raii::DescriptorSetLayout>       mpTextureSetLayout               ; // set 1; one combined image sampler per texture
 			std::unique_ptr<vk::raii::PipelineLayout>            mpGraphicsPipelineLayout         ;
+			std::unique_ptr<UniformRing>                         mpUniformRing                    ; // NOTE: remade (larger) whenever a frame outgrows it
+			CameraUniforms                                       mCameraUniforms                  ;
 			std::unique_ptr<vk::raii::RenderPass>                mpRenderPass                     ;
 			std::unique_ptr<vk::raii::Pipeline>                  mpGraphicsPipeline               ;
 			std::vector<vk::raii::Framebuffer>                   mFramebuffers                    ; // NOTE: Must be deleted before swapchain!
-			bool                                                 mShouldRemakeSwapchain           ;
+			std::atomic<bool>                                    mShouldRemakeSwapchain           ; // set by the window's resize callback (on the main thread)
 			std::vector<vk::raii::Semaphore>                     mImageAvailable                  ;
 			std::vector<vk::raii::Semaphore>                     mImagePresentable                ;
-			std::vector<vk::raii::Fence>                         mFencesInFlight                  ; // TODO: better name
+			std::unique_ptr<FrameTimeline>                       mpFrameTimeline                  ; // completion of submitted frames
 			u64                                                  mCurrentFrame                    ;
+			DrawList                                             mDrawList                        ;
+			std::unique_ptr<Buffer>                              mpReadbackBuffer                 ; // NOTE: created on first request
+			bool                                                 mIsReadbackRequested             ;
+			std::optional<u64>                                   mPendingReadbackFrame            ;
+			RecordingStats                                       mRecordingStats                  ;
+			FrameTimings                                         mFrameTimings                    ;
+			LatencyStats                                         mLatencyStats                    ;
+			FramePacer                                           mFramePacer                      ;
+			StagingStats                                         mStagingStats                    ;
+			bool                                                 mHasBegunFrame                   ; // i.e. `beginFrame` was called for `mCurrentFrame`
 	}; // end-of-class: Renderer
+	
+	
+	
+	template <typename T>
+	void
+	Renderer::retire( T &&resource )
+	{
+		// NOTE: every frame up until (but excluding) `mCurrentFrame` has been submitted and might use the resource
+		mpDeletionQueue->retire( std::forward<T>( resource ), mCurrentFrame, mCurrentFrame );
+	} // end-of-function: Renderer::retire
 } // end-of-namespace: gfx
 
 #endif // end-of-header-guard RENDERER_HPP_YBLYHOXN
@@ -0,0 +1,151 @@
+#include "MyTemplate/Renderer/RendererConfig.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		std::array constexpr kPresentationPriorityNames {
+			std::pair { std::string_view { "minimal-latency"           }, PresentationPriority::eMinimalLatency          },
+			std::pair { std::string_view { "minimal-stuttering"        }, PresentationPriority::eMinimalStuttering       },
+			std::pair { std::string_view { "minimal-power-consumption" }, PresentationPriority::eMinimalPowerConsumption },
+		};
+		
+		std::array constexpr kFramebufferingPriorityNames {
+			std::pair { std::string_view { "single" }, FramebufferingPriority::eSingle },
+			std::pair { std::string_view { "double" }, FramebufferingPriority::eDouble },
+			std::pair { std::string_view { "triple" }, FramebufferingPriority::eTriple },
+		};
+		
+		std::array constexpr kSwitchNames {
+			std::pair { std::string_view { "on"  }, true  },
+			std::pair { std::string_view { "off" }, false },
+		};
+		
+		template <typename Enum, std::size_t N>
+		[[nodiscard]] Enum
+		parseEnum( std::array<std::pair<std::string_view,Enum>,N> const &names, std::string_view const value )
+		{
+			auto const it { std::ranges::find( names, value, &std::pair<std::string_view,Enum>::first ) };
+			if ( it == names.end() ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "Invalid renderer config value `{}`!", value ) };
+			return it->second;
+		} // end-of-function: parseEnum
+		
+		template <typename Enum, std::size_t N>
+		[[nodiscard]] std::string_view
+		getEnumName( std::array<std::pair<std::string_view,Enum>,N> const &names, Enum const value ) noexcept
+		{
+			auto const it { std::ranges::find( names, value, &std::pair<std::string_view,Enum>::second ) };
+			return it == names.end() ? "?" : it->first;
+		} // end-of-function: getEnumName
+		
+		[[nodiscard]] u32
+		parseCount( std::string_view const value )
+		{
+			u32 count { 0 };
+			auto const [end, error] { std::from_chars( value.data(), value.data() + value.size(), count ) };
+			if ( error != std::errc{} or end != value.data() + value.size() ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "Invalid renderer config value `{}`!", value ) };
+			return count;
+		} // end-of-function: parseCount
+		
+		[[nodiscard]] std::string_view
+		trim( std::string_view text ) noexcept
+		{
+			auto const first { text.find_first_not_of( " \t\r" ) };
+			if ( first == std::string_view::npos )
+				return {};
+			auto const last { text.find_last_not_of( " \t\r" ) };
+			return text.substr( first, last - first + 1 );
+		} // end-of-function: trim
+	} // end-of-unnamed-namespace
+	
+	
+	
+	bool
+	RendererConfig::setOption( std::string_view const name, std::string_view const value )
+	{
+		if ( name == "frames-in-flight" )
+			framesInFlight = parseCount( value );
+		else if ( name == "presentation-priority" )
+			presentationPriority = parseEnum( kPresentationPriorityNames, value );
+		else if ( name == "framebuffering-priority" )
+			framebufferingPriority = parseEnum( kFramebufferingPriorityNames, value );
+		else if ( name == "frame-pacing" )
+			isFramePacingEnabled = parseEnum( kSwitchNames, value );
+		else if ( name == "staging-ring-size" )
+			stagingRingSizeMiB = parseCount( value );
+		else
+			return false;
+		return true;
+	} // end-of-function: RendererConfig::setOption
+	
+	
+	
+	void
+	RendererConfig::loadFile( std::filesystem::path const &path )
+	{
+		spdlog::info( "Loading renderer config from `{}`...", path.string() );
+		std::ifstream file( path );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { "Failed to open the renderer config file!" };
+		u32 lineNumber { 0 };
+		for ( std::string line; std::getline( file, line ); ) {
+			++lineNumber;
+			std::string_view text { line };
+			text = trim( text.substr( 0, text.find( '#' ) ) );
+			if ( text.empty() )
+				continue;
+			auto const separator { text.find( '=' ) };
+			if ( separator == std::string_view::npos ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "Malformed renderer config line #{}!", lineNumber ) };
+			auto const name  { trim( text.substr( 0, separator ) ) };
+			auto const value { trim( text.substr( separator + 1 ) ) };
+			if ( not setOption( name, value ) ) [[unlikely]]
+				spdlog::warn( "... ignoring unknown option `{}` on line #{}", name, lineNumber );
+		}
+		validate();
+	} // end-of-function: RendererConfig::loadFile
+	
+	
+	
+	void
+	RendererConfig::validate() const
+	{
+		if ( framesInFlight < 1 or framesInFlight > kMaxFramesInFlight ) [[unlikely]]
+			throw std::runtime_error {
+				fmt::format( "Frames in flight must be in the range [1,{}]!", kMaxFramesInFlight )
+			};
+		if ( stagingRingSizeMiB < 1 or stagingRingSizeMiB > kMaxStagingRingSizeMiB ) [[unlikely]]
+			throw std::runtime_error {
+				fmt::format( "The staging ring size must be in the range [1,{}] MiB!", kMaxStagingRingSizeMiB )
+			};
+	} // end-of-function: RendererConfig::validate
+	
+	
+	
+	void
+	RendererConfig::log() const
+	{
+		spdlog::info(
+			"Renderer config: frames-in-flight = {}, presentation-priority = {}, framebuffering-priority = {}, frame-pacing = {}, staging-ring-size = {}",
+			framesInFlight,
+			getEnumName( kPresentationPriorityNames,   presentationPriority   ),
+			getEnumName( kFramebufferingPriorityNames, framebufferingPriority ),
+			getEnumName( kSwitchNames,                 isFramePacingEnabled   ),
+			stagingRingSizeMiB
+		);
+	} // end-of-function: RendererConfig::log
+} // end-of-namespace: gfx
+// EOF
@@ -0,0 +1,43 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef RENDERERCONFIG_HPP_V6LC3NRB
+#define RENDERERCONFIG_HPP_V6LC3NRB
+
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <filesystem>
+#include <string_view>
+
+namespace gfx {
+	// Renderer settings that may be changed at run-time (see `Renderer::setConfig`).
+	// NOTE: Options are set by name; in files as `name = value` lines (`#` starts a comment),
+	//       and on the command line as `--name value`:
+	//         frames-in-flight        = 1..kMaxFramesInFlight
+	//         presentation-priority   = minimal-latency | minimal-stuttering | minimal-power-consumption
+	//         framebuffering-priority = single | double | triple
+	//         frame-pacing            = on | off (only used with minimal-latency; see `FramePacer`)
+	//         staging-ring-size       = 1..kMaxStagingRingSizeMiB (in MiB; only used when the renderer is made)
+	struct RendererConfig final {
+		// NOTE: Per frame slot resources (command pools, staging space, queries, etc) are made for this
+		//       many slots up front, so changing the frames in flight never has to remake them.
+		inline static u32 constexpr kMaxFramesInFlight     {    4 };
+		inline static u32 constexpr kMaxStagingRingSizeMiB { 1024 };
+		
+		u32                    framesInFlight         { 3                                        };
+		PresentationPriority   presentationPriority   { PresentationPriority::eMinimalStuttering };
+		FramebufferingPriority framebufferingPriority { FramebufferingPriority::eTriple          };
+		bool                   isFramePacingEnabled   { false                                    };
+		u32                    stagingRingSizeMiB     { 16                                       }; // uploads beyond it fall back on dedicated staging buffers
+		
+		// returns false if there's no option by that name; throws if the value is invalid:
+		bool setOption( std::string_view const name, std::string_view const value );
+		// sets the options found in the file (others are left as is); throws if the file is malformed:
+		void loadFile( std::filesystem::path const & );
+		void validate() const; // throws if any option is out of range
+		void log() const;
+		
+		[[nodiscard]] bool operator==( RendererConfig const & ) const noexcept = default;
+	}; // end-of-struct: RendererConfig
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard RENDERERCONFIG_HPP_V6LC3NRB
+// EOF
@@ -0,0 +1,48 @@
+#include "MyTemplate/Renderer/SamplerCache.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace gfx {
+	SamplerCache::SamplerCache( vk::raii::Device const &device ):
+		mpDevice { &device },
+		mEntries {         },
+		mMutex   {         }
+	{
+		spdlog::info( "Constructing a SamplerCache instance..." );
+	} // end-of-function: SamplerCache::SamplerCache
+	
+	
+	
+	[[nodiscard]] vk::Sampler
+	SamplerCache::get( vk::SamplerCreateInfo const &createInfo )
+	{
+		// pre-condition(s):
+		//   chained structs would have to be compared by value (which `operator==` doesn't do):
+		assert( createInfo.pNext == nullptr );
+		
+		std::scoped_lock const lock { mMutex };
+		auto const match {
+			std::ranges::find_if( mEntries, [&createInfo]( Entry const &entry ) { return entry.createInfo == createInfo; } )
+		};
+		if ( match != mEntries.end() ) [[likely]]
+			return *match->sampler;
+		
+		spdlog::info( "Creating sampler #{}...", mEntries.size() );
+		mEntries.push_back( Entry { createInfo, vk::raii::Sampler( *mpDevice, createInfo ) } );
+		return *mEntries.back().sampler;
+	} // end-of-function: SamplerCache::get
+	
+	
+	
+	[[nodiscard]] u32
+	SamplerCache::getSize() const
+	{
+		std::scoped_lock const lock { mMutex };
+		return static_cast<u32>( mEntries.size() );
+	} // end-of-function: SamplerCache::getSize
+} // end-of-namespace: gfx
+// EOF
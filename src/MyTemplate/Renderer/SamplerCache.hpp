@@ -0,0 +1,62 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef SAMPLERCACHE_HPP_J2DX6MWF
+#define SAMPLERCACHE_HPP_J2DX6MWF
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace gfx {
+	// Owns every sampler and hands out the same one for identical create infos.
+	// NOTE: Devices cap the number of samplers (`maxSamplerAllocationCount`; as low as 4000) while only a
+	//       handful of distinct states tend to be used, so textures share samplers instead of owning them.
+	//       The handles stay valid for the lifetime of the cache.
+	class SamplerCache final {
+		public:
+			// trilinear filtering and repeat addressing over every mip level:
+			inline static vk::SamplerCreateInfo constexpr kDefaultCreateInfo {
+				.magFilter               = vk::Filter::eLinear,
+				.minFilter               = vk::Filter::eLinear,
+				.mipmapMode              = vk::SamplerMipmapMode::eLinear,
+				.addressModeU            = vk::SamplerAddressMode::eRepeat,
+				.addressModeV            = vk::SamplerAddressMode::eRepeat,
+				.addressModeW            = vk::SamplerAddressMode::eRepeat,
+				.mipLodBias              = 0.0f,
+				.anisotropyEnable        = VK_FALSE,
+				.maxAnisotropy           = 1.0f,
+				.compareEnable           = VK_FALSE,
+				.compareOp               = vk::CompareOp::eAlways,
+				.minLod                  = 0.0f,
+				.maxLod                  = VK_LOD_CLAMP_NONE,
+				.borderColor             = vk::BorderColor::eIntOpaqueBlack,
+				.unnormalizedCoordinates = VK_FALSE
+			};
+			
+			explicit SamplerCache( vk::raii::Device const & );
+			SamplerCache(             SamplerCache const &  ) = delete;
+			SamplerCache(             SamplerCache       && ) = delete;
+			SamplerCache & operator=( SamplerCache const &  ) = delete;
+			SamplerCache & operator=( SamplerCache       && ) = delete;
+			
+			// thread-safe; creates the sampler on first use (`pNext` chains aren't supported):
+			[[nodiscard]] vk::Sampler get( vk::SamplerCreateInfo const & );
+			[[nodiscard]] u32         getSize() const;
+		
+		private:
+			struct Entry final {
+				vk::SamplerCreateInfo createInfo;
+				vk::raii::Sampler     sampler;
+			}; // end-of-struct: SamplerCache::Entry
+			
+			vk::raii::Device const *mpDevice;
+			std::vector<Entry>      mEntries; // NOTE: few enough that a linear search beats hashing
+			mutable std::mutex      mMutex;
+	}; // end-of-class: SamplerCache
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard SAMPLERCACHE_HPP_J2DX6MWF
+// EOF
@@ -0,0 +1,72 @@
+#include "MyTemplate/Renderer/StagingRing.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Renderer/Suballocator.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+#include <utility>
+#include <cassert>
+
+namespace gfx {
+	StagingRing::StagingRing(
+		std::unique_ptr<Buffer> pBuffer,
+		vk::DeviceSize const    capacity,
+		u32            const    frameSlotCount
+	):
+		mpBuffer { std::move( pBuffer )        },
+		mRing    { capacity, frameSlotCount    }
+	{
+		spdlog::info( "Constructing a StagingRing instance ({} bytes)...", capacity );
+		if ( mpBuffer == nullptr or mpBuffer->allocation.getMappedData() == nullptr ) [[unlikely]]
+			throw std::runtime_error { "Staging ring buffer must be host visible!" };
+	} // end-of-function: StagingRing::StagingRing
+	
+	
+	
+	[[nodiscard]] std::optional<StagingRing::Slice>
+	StagingRing::allocate( vk::DeviceSize const size, vk::DeviceSize const alignment ) noexcept
+	{
+		auto const maybeOffset { mRing.allocate( size, alignment ) };
+		if ( not maybeOffset ) [[unlikely]]
+			return std::nullopt;
+		return Slice {
+			.buffer = *mpBuffer->handle,
+			.offset = *maybeOffset,
+			.pData  = static_cast<char *>( mpBuffer->allocation.getMappedData() ) + *maybeOffset
+		};
+	} // end-of-function: StagingRing::allocate
+	
+	
+	
+	void
+	StagingRing::beginFrame( u32 const frameSlot ) noexcept
+	{
+		mRing.releaseFrame( frameSlot );
+	} // end-of-function: StagingRing::beginFrame
+	
+	
+	
+	void
+	StagingRing::endFrame( u32 const frameSlot ) noexcept
+	{
+		mRing.endFrame( frameSlot );
+	} // end-of-function: StagingRing::endFrame
+	
+	
+	
+	[[nodiscard]] vk::DeviceSize
+	StagingRing::getUsedSize() const noexcept
+	{
+		return mRing.getUsedSize();
+	} // end-of-function: StagingRing::getUsedSize
+	
+	
+	
+	[[nodiscard]] vk::DeviceSize
+	StagingRing::getHighWaterMark() const noexcept
+	{
+		return mRing.getHighWaterMark();
+	} // end-of-function: StagingRing::getHighWaterMark
+} // end-of-namespace: gfx
+// EOF
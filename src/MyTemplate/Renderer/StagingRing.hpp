@@ -0,0 +1,40 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef STAGINGRING_HPP_H5PZ2UWD
+#define STAGINGRING_HPP_H5PZ2UWD
+
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Renderer/Suballocator.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <memory>
+#include <optional>
+
+namespace gfx {
+	// Persistently mapped host visible buffer that all staged uploads are written into at a bump offset.
+	// Space is recycled per frame in flight once the frame has completed.
+	class StagingRing final {
+		public:
+			struct Slice final {
+				vk::Buffer      buffer;
+				vk::DeviceSize  offset;
+				void           *pData; // mapped pointer to the start of the slice
+			}; // end-of-struct: StagingRing::Slice
+			
+			StagingRing( std::unique_ptr<Buffer> pBuffer, vk::DeviceSize const capacity, u32 const frameSlotCount );
+			
+			[[nodiscard]] std::optional<Slice> allocate( vk::DeviceSize const size, vk::DeviceSize const alignment = 16 ) noexcept;
+			void                               beginFrame( u32 const frameSlot ) noexcept; // call after the slot's previous frame has completed
+			void                               endFrame(   u32 const frameSlot ) noexcept; // call after the slot's frame has been submitted
+			[[nodiscard]] vk::DeviceSize       getUsedSize()      const noexcept;
+			[[nodiscard]] vk::DeviceSize       getHighWaterMark() const noexcept;
+		
+		private:
+			std::unique_ptr<Buffer>  mpBuffer;
+			RingSuballocator         mRing;
+	}; // end-of-class: StagingRing
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard STAGINGRING_HPP_H5PZ2UWD
+// EOF
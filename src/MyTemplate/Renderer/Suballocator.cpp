@@ -0,0 +1,325 @@
+#include "MyTemplate/Renderer/Suballocator.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/utility.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <cassert>
+
+namespace gfx {
+	FreeListSuballocator::FreeListSuballocator( u64 const capacity ):
+		mCapacity   { capacity },
+		mUsedSize   { 0        },
+		mFreeRanges {          },
+		mAllocations{          }
+	{
+		if ( capacity > 0 ) [[likely]]
+			mFreeRanges.emplace( 0, capacity );
+	} // end-of-function: FreeListSuballocator::FreeListSuballocator
+	
+	
+	
+	[[nodiscard]] std::optional<u64>
+	FreeListSuballocator::allocate( u64 const size, u64 const alignment )
+	{
+		// pre-condition(s):
+		assert( size > 0 );
+		assert( alignment > 0 and (alignment & (alignment - 1)) == 0 ); // power of two
+		
+		// best-fit: pick the smallest free range that can hold the aligned allocation
+		auto bestMatch { mFreeRanges.end() };
+		u64  bestWaste { max<u64>          };
+		for ( auto it{ mFreeRanges.begin() };  it != mFreeRanges.end();  ++it ) {
+			auto const [rangeOffset, rangeSize] { *it };
+			auto const alignedOffset { alignUp( rangeOffset, alignment ) };
+			auto const padding       { alignedOffset - rangeOffset };
+			if ( padding > rangeSize or rangeSize - padding < size )
+				continue;
+			auto const waste { rangeSize - padding - size };
+			if ( waste < bestWaste ) {
+				bestWaste = waste;
+				bestMatch = it;
+				if ( waste == 0 ) [[unlikely]]
+					break; // early exit; can't do better than a perfect fit
+			}
+		}
+		
+		if ( bestMatch == mFreeRanges.end() ) [[unlikely]]
+			return std::nullopt;
+		
+		auto const [rangeOffset, rangeSize] { *bestMatch };
+		auto const alignedOffset { alignUp( rangeOffset, alignment ) };
+		auto const padding       { alignedOffset - rangeOffset };
+		auto const remainder     { rangeSize - padding - size };
+		mFreeRanges.erase( bestMatch );
+		// any leading alignment padding and trailing remainder stay free:
+		if ( padding > 0 )
+			mFreeRanges.emplace( rangeOffset, padding );
+		if ( remainder > 0 )
+			mFreeRanges.emplace( alignedOffset + size, remainder );
+		
+		mAllocations.emplace( alignedOffset, size );
+		mUsedSize += size;
+		return alignedOffset;
+	} // end-of-function: FreeListSuballocator::allocate
+	
+	
+	
+	void
+	FreeListSuballocator::free( u64 const offset ) noexcept
+	{
+		// NOTE: the allocation's node is reused for the free range, so nothing is allocated (and nothing can throw)
+		auto node { mAllocations.extract( offset ) };
+		// pre-condition(s):
+		assert( not node.empty() ); // i.e. a live sub-allocation (freed at most once)
+		if ( node.empty() ) [[unlikely]]
+			return; // NOTE: ignored in release builds
+		
+		mUsedSize -= node.mapped();
+		insertFreeRange( std::move( node ) );
+	} // end-of-function: FreeListSuballocator::free
+	
+	
+	
+	void
+	FreeListSuballocator::insertFreeRange( Node node ) noexcept
+	{
+		auto const offset { node.key() };
+		auto      &size   { node.mapped() };
+		// coalesce with the following free range (if adjacent):
+		auto next { mFreeRanges.lower_bound( offset ) };
+		if ( next != mFreeRanges.end() and offset + size == next->first ) {
+			size += next->second;
+			next  = mFreeRanges.erase( next );
+		}
+		// coalesce with the preceding free range (if adjacent):
+		if ( next != mFreeRanges.begin() ) {
+			auto prev { std::prev( next ) };
+			if ( prev->first + prev->second == offset ) {
+				prev->second += size;
+				return;
+			}
+		}
+		mFreeRanges.insert( next, std::move( node ) );
+	} // end-of-function: FreeListSuballocator::insertFreeRange
+	
+	
+	
+	[[nodiscard]] u64
+	FreeListSuballocator::getCapacity() const noexcept
+	{
+		return mCapacity;
+	} // end-of-function: FreeListSuballocator::getCapacity
+	
+	
+	
+	[[nodiscard]] u64
+	FreeListSuballocator::getUsedSize() const noexcept
+	{
+		return mUsedSize;
+	} // end-of-function: FreeListSuballocator::getUsedSize
+	
+	
+	
+	[[nodiscard]] u64
+	FreeListSuballocator::getFreeSize() const noexcept
+	{
+		return mCapacity - mUsedSize;
+	} // end-of-function: FreeListSuballocator::getFreeSize
+	
+	
+	
+	[[nodiscard]] u64
+	FreeListSuballocator::getLargestFreeRange() const noexcept
+	{
+		u64 largest { 0 };
+		for ( auto const &[offset, size]: mFreeRanges )
+			largest = std::max( largest, size );
+		return largest;
+	} // end-of-function: FreeListSuballocator::getLargestFreeRange
+	
+	
+	
+	[[nodiscard]] u64
+	FreeListSuballocator::getAllocationCount() const noexcept
+	{
+		return mAllocations.size();
+	} // end-of-function: FreeListSuballocator::getAllocationCount
+	
+	
+	
+	[[nodiscard]] u64
+	FreeListSuballocator::getFreeRangeCount() const noexcept
+	{
+		return mFreeRanges.size();
+	} // end-of-function: FreeListSuballocator::getFreeRangeCount
+	
+	
+	
+	[[nodiscard]] f32
+	FreeListSuballocator::getFragmentation() const noexcept
+	{
+		auto const freeSize { getFreeSize() };
+		if ( freeSize == 0 ) [[unlikely]]
+			return 0.0f;
+		return 1.0f - static_cast<f32>( getLargestFreeRange() ) / static_cast<f32>( freeSize );
+	} // end-of-function: FreeListSuballocator::getFragmentation
+	
+	
+	
+	[[nodiscard]] bool
+	FreeListSuballocator::isEmpty() const noexcept
+	{
+		return mAllocations.empty();
+	} // end-of-function: FreeListSuballocator::isEmpty
+	
+	
+	
+	LinearSuballocator::LinearSuballocator( u64 const capacity ) noexcept:
+		mCapacity { capacity },
+		mHead     { 0        }
+	{} // end-of-function: LinearSuballocator::LinearSuballocator
+	
+	
+	
+	[[nodiscard]] std::optional<u64>
+	LinearSuballocator::allocate( u64 const size, u64 const alignment ) noexcept
+	{
+		// pre-condition(s):
+		assert( alignment > 0 and (alignment & (alignment - 1)) == 0 ); // power of two
+		
+		auto const alignedOffset { alignUp( mHead, alignment ) };
+		if ( alignedOffset > mCapacity or mCapacity - alignedOffset < size ) [[unlikely]]
+			return std::nullopt;
+		mHead = alignedOffset + size;
+		return alignedOffset;
+	} // end-of-function: LinearSuballocator::allocate
+	
+	
+	
+	void
+	LinearSuballocator::reset() noexcept
+	{
+		mHead = 0;
+	} // end-of-function: LinearSuballocator::reset
+	
+	
+	
+	[[nodiscard]] u64
+	LinearSuballocator::getCapacity() const noexcept
+	{
+		return mCapacity;
+	} // end-of-function: LinearSuballocator::getCapacity
+	
+	
+	
+	[[nodiscard]] u64
+	LinearSuballocator::getUsedSize() const noexcept
+	{
+		return mHead;
+	} // end-of-function: LinearSuballocator::getUsedSize
+	
+	
+	
+	RingSuballocator::RingSuballocator( u64 const capacity, u32 const frameSlotCount ):
+		mCapacity     { capacity       },
+		mHead         { 0              },
+		mTail         { 0              },
+		mUsedSize     { 0              },
+		mPendingSize  { 0              },
+		mHighWaterMark{ 0              },
+		mMarkers      ( frameSlotCount )
+	{} // end-of-function: RingSuballocator::RingSuballocator
+	
+	
+	
+	[[nodiscard]] std::optional<u64>
+	RingSuballocator::allocate( u64 const size, u64 const alignment ) noexcept
+	{
+		// pre-condition(s):
+		assert( alignment > 0 and (alignment & (alignment - 1)) == 0 ); // power of two
+		
+		if ( mUsedSize == 0 ) // nothing in flight; rewind for maximum contiguous space
+			mHead = mTail = 0;
+		
+		u64 const alignedOffset { alignUp( mHead, alignment ) };
+		std::optional<u64> result {};
+		if ( mHead >= mTail and mUsedSize < mCapacity ) {
+			// free space is [head, capacity) followed by [0, tail):
+			if ( alignedOffset <= mCapacity and mCapacity - alignedOffset >= size )
+				result = alignedOffset;
+			else if ( size <= mTail ) { // wrap around; the end of the range is wasted
+				mUsedSize    += mCapacity - mHead;
+				mPendingSize += mCapacity - mHead;
+				mHead         = 0;
+				result        = 0;
+			}
+		}
+		else if ( mHead < mTail ) {
+			// free space is [head, tail):
+			if ( alignedOffset <= mTail and mTail - alignedOffset >= size )
+				result = alignedOffset;
+		}
+		
+		if ( not result ) [[unlikely]]
+			return std::nullopt;
+		
+		auto const consumed { (*result + size) - mHead }; // including alignment padding
+		mHead          = *result + size;
+		mUsedSize     += consumed;
+		mPendingSize  += consumed;
+		mHighWaterMark = std::max( mHighWaterMark, mUsedSize );
+		return result;
+	} // end-of-function: RingSuballocator::allocate
+	
+	
+	
+	void
+	RingSuballocator::endFrame( u32 const frameSlot ) noexcept
+	{
+		assert( frameSlot < mMarkers.size() );
+		assert( mMarkers[frameSlot].size == 0 ); // should've been released before being reused
+		mMarkers[frameSlot] = Marker { .end = mHead, .size = mPendingSize };
+		mPendingSize = 0;
+	} // end-of-function: RingSuballocator::endFrame
+	
+	
+	
+	void
+	RingSuballocator::releaseFrame( u32 const frameSlot ) noexcept
+	{
+		assert( frameSlot < mMarkers.size() );
+		auto &marker { mMarkers[frameSlot] };
+		if ( marker.size == 0 )
+			return;
+		mTail      = marker.end;
+		mUsedSize -= marker.size;
+		marker     = Marker {};
+	} // end-of-function: RingSuballocator::releaseFrame
+	
+	
+	
+	[[nodiscard]] u64
+	RingSuballocator::getCapacity() const noexcept
+	{
+		return mCapacity;
+	} // end-of-function: RingSuballocator::getCapacity
+	
+	
+	
+	[[nodiscard]] u64
+	RingSuballocator::getUsedSize() const noexcept
+	{
+		return mUsedSize;
+	} // end-of-function: RingSuballocator::getUsedSize
+	
+	
+	
+	[[nodiscard]] u64
+	RingSuballocator::getHighWaterMark() const noexcept
+	{
+		return mHighWaterMark;
+	} // end-of-function: RingSuballocator::getHighWaterMark
+} // end-of-namespace: gfx
+// EOF
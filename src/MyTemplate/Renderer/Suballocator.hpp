@@ -0,0 +1,103 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef SUBALLOCATOR_HPP_QF3W8ZKD
+#define SUBALLOCATOR_HPP_QF3W8ZKD
+
+#include "MyTemplate/Common/aliases.hpp"
+
+#include <map>
+#include <optional>
+#include <vector>
+
+// NOTE: Everything in here is pure CPU-side bookkeeping of offsets within a contiguous range;
+//       no Vulkan calls are made, which keeps the allocation logic testable in isolation.
+
+namespace gfx {
+	[[nodiscard]] constexpr u64
+	alignUp( u64 const value, u64 const alignment ) noexcept
+	{
+		// pre-condition(s): alignment must be a power of two (guaranteed by Vulkan for all alignments)
+		return (value + alignment - 1) & ~(alignment - 1);
+	} // end-of-function: alignUp
+	
+	
+	
+	// General purpose sub-allocator; best-fit search with coalescing of neighbouring free ranges.
+	class FreeListSuballocator final {
+		public:
+			explicit FreeListSuballocator( u64 const capacity );
+			
+			[[nodiscard]] std::optional<u64> allocate( u64 const size, u64 const alignment ); // returns offset
+			void                             free(     u64 const offset ) noexcept;
+			
+			[[nodiscard]] u64  getCapacity()         const noexcept;
+			[[nodiscard]] u64  getUsedSize()         const noexcept;
+			[[nodiscard]] u64  getFreeSize()         const noexcept;
+			[[nodiscard]] u64  getLargestFreeRange() const noexcept;
+			[[nodiscard]] u64  getAllocationCount()  const noexcept;
+			[[nodiscard]] u64  getFreeRangeCount()   const noexcept;
+			[[nodiscard]] f32  getFragmentation()    const noexcept; // 0 = all free space is contiguous, ~1 = scattered
+			[[nodiscard]] bool isEmpty()             const noexcept;
+		
+		private:
+			using Node = std::map<u64,u64>::node_type; // NOTE: moved between the two maps when freeing (see: `free`)
+			
+			void insertFreeRange( Node ) noexcept;
+			
+			u64               mCapacity;
+			u64               mUsedSize;
+			std::map<u64,u64> mFreeRanges;  // offset -> size (ordered for coalescing)
+			std::map<u64,u64> mAllocations; // offset -> size (of live allocations)
+	}; // end-of-class: FreeListSuballocator
+	
+	
+	
+	// Bump allocator for short-lived allocations that are all released at once via `reset()`.
+	class LinearSuballocator final {
+		public:
+			explicit LinearSuballocator( u64 const capacity ) noexcept;
+			
+			[[nodiscard]] std::optional<u64> allocate( u64 const size, u64 const alignment ) noexcept; // returns offset
+			void                             reset() noexcept;
+			
+			[[nodiscard]] u64 getCapacity() const noexcept;
+			[[nodiscard]] u64 getUsedSize() const noexcept;
+		
+		private:
+			u64 mCapacity;
+			u64 mHead;
+	}; // end-of-class: LinearSuballocator
+	
+	
+	
+	// FIFO allocator over a circular range; allocations are released in bulk per frame slot,
+	// in the same order as the frames were ended (which matches GPU completion order).
+	class RingSuballocator final {
+		public:
+			RingSuballocator( u64 const capacity, u32 const frameSlotCount );
+			
+			[[nodiscard]] std::optional<u64> allocate( u64 const size, u64 const alignment ) noexcept; // returns offset
+			void                             endFrame(     u32 const frameSlot ) noexcept; // attributes pending allocations to the slot
+			void                             releaseFrame( u32 const frameSlot ) noexcept; // once the slot's frame has completed
+			
+			[[nodiscard]] u64 getCapacity()     const noexcept;
+			[[nodiscard]] u64 getUsedSize()     const noexcept; // including padding and wrap-around waste
+			[[nodiscard]] u64 getHighWaterMark() const noexcept;
+		
+		private:
+			struct Marker final {
+				u64 end  { 0 }; // head position when the frame ended
+				u64 size { 0 }; // bytes consumed by the frame
+			}; // end-of-struct: RingSuballocator::Marker
+			
+			u64                 mCapacity;
+			u64                 mHead;
+			u64                 mTail;
+			u64                 mUsedSize;
+			u64                 mPendingSize; // consumed since the last `endFrame`
+			u64                 mHighWaterMark;
+			std::vector<Marker> mMarkers;     // one per frame slot
+	}; // end-of-class: RingSuballocator
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard SUBALLOCATOR_HPP_QF3W8ZKD
+// EOF
@@ -0,0 +1,91 @@
+#include "MyTemplate/Renderer/Texture.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <utility>
+
+namespace gfx {
+	Texture::Texture(
+		Image                       image,
+		vk::raii::ImageView         view,
+		vk::Sampler         const   sampler,
+		vk::raii::DescriptorSet     descriptorSet,
+		vk::Extent2D        const   extent,
+		vk::Format          const   format,
+		u32                 const   mipLevelCount,
+		UploadTicket        const   uploadTicket
+	) noexcept:
+		mImage         { std::move( image         ) },
+		mView          { std::move( view          ) },
+		mSampler       { sampler                    },
+		mDescriptorSet { std::move( descriptorSet ) },
+		mExtent        { extent                     },
+		mFormat        { format                     },
+		mMipLevelCount { mipLevelCount              },
+		mUploadTicket  { uploadTicket               }
+	{} // end-of-function: Texture::Texture
+	
+	
+	
+	[[nodiscard]] vk::Image
+	Texture::getImage() const noexcept
+	{
+		return *mImage.handle;
+	} // end-of-function: Texture::getImage
+	
+	
+	
+	[[nodiscard]] vk::ImageView
+	Texture::getView() const noexcept
+	{
+		return *mView;
+	} // end-of-function: Texture::getView
+	
+	
+	
+	[[nodiscard]] vk::Sampler
+	Texture::getSampler() const noexcept
+	{
+		return mSampler;
+	} // end-of-function: Texture::getSampler
+	
+	
+	
+	[[nodiscard]] vk::DescriptorSet
+	Texture::getDescriptorSet() const noexcept
+	{
+		return *mDescriptorSet;
+	} // end-of-function: Texture::getDescriptorSet
+	
+	
+	
+	[[nodiscard]] vk::Extent2D
+	Texture::getExtent() const noexcept
+	{
+		return mExtent;
+	} // end-of-function: Texture::getExtent
+	
+	
+	
+	[[nodiscard]] vk::Format
+	Texture::getFormat() const noexcept
+	{
+		return mFormat;
+	} // end-of-function: Texture::getFormat
+	
+	
+	
+	[[nodiscard]] u32
+	Texture::getMipLevelCount() const noexcept
+	{
+		return mMipLevelCount;
+	} // end-of-function: Texture::getMipLevelCount
+	
+	
+	
+	[[nodiscard]] UploadTicket
+	Texture::getUploadTicket() const noexcept
+	{
+		return mUploadTicket;
+	} // end-of-function: Texture::getUploadTicket
+} // end-of-namespace: gfx
+// EOF
@@ -3,19 +3,55 @@
 #define TEXTURE_HPP_LIQCQ7RZ
 
 #include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Renderer/UploadService.hpp"
+
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_raii.hpp>
 
-struct Texture final
-{
-	vk::Image         image;
-	vk::ImageView     view;    // needed for use within shaders
-	vk::DeviceMemory  memory;  // needed for the image data
-	vk::ImageLayout   layout;  // current memory layout
-	vk::Sampler       sampler; // current sampler state
-	u16               width;
-	u16               height;
-};
+namespace gfx {
+	// Sampled 2D image on pooled device memory (see: Renderer::makeTexture).
+	// NOTE: The image is in `eShaderReadOnlyOptimal` layout once its upload has completed, and it is
+	//       owned by the graphics queue family. The sampler is owned (and shared) by the sampler cache.
+	//       The descriptor set (set 1 of the graphics pipeline layout) is what draws select the texture with.
+	//       Hand textures to `Renderer::retire` rather than destroying them while frames may use them.
+	class Texture final {
+		public:
+			Texture(
+				Image                       image,
+				vk::raii::ImageView         view,
+				vk::Sampler         const   sampler,
+				vk::raii::DescriptorSet     descriptorSet,
+				vk::Extent2D        const   extent,
+				vk::Format          const   format,
+				u32                 const   mipLevelCount,
+				UploadTicket        const   uploadTicket
+			) noexcept;
+			Texture(             Texture const &  )          = delete;
+			Texture(             Texture       && ) noexcept = default;
+			Texture & operator=( Texture const &  )          = delete;
+			Texture & operator=( Texture       && ) noexcept = default;
+			
+			[[nodiscard]] vk::Image         getImage()         const noexcept;
+			[[nodiscard]] vk::ImageView     getView()          const noexcept;
+			[[nodiscard]] vk::Sampler       getSampler()       const noexcept;
+			[[nodiscard]] vk::DescriptorSet getDescriptorSet() const noexcept; // see: DrawCommand::textureSet
+			[[nodiscard]] vk::Extent2D      getExtent()        const noexcept;
+			[[nodiscard]] vk::Format        getFormat()        const noexcept;
+			[[nodiscard]] u32               getMipLevelCount() const noexcept;
+			[[nodiscard]] UploadTicket      getUploadTicket()  const noexcept; // see: Renderer::isTextureReady
+		
+		private:
+			Image                   mImage;
+			vk::raii::ImageView     mView;          // NOTE: declared after the image so that it's destroyed first
+			vk::Sampler             mSampler;
+			vk::raii::DescriptorSet mDescriptorSet; // NOTE: declared after the view so that it's freed first
+			vk::Extent2D            mExtent;        // NOTE: 32-bit, so e.g. 8k and 16k atlases are fine
+			vk::Format              mFormat;
+			u32                     mMipLevelCount;
+			UploadTicket            mUploadTicket;
+	}; // end-of-class: Texture
+} // end-of-namespace: gfx
 
 #endif // end-of-header-guard TEXTURE_HPP_LIQCQ7RZ
 // EOF
@@ -0,0 +1,246 @@
+#include "MyTemplate/Renderer/TextureFile.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/utility.hpp"
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		static_assert( std::endian::native == std::endian::little, "KTX2 files are read and written as is (i.e. little-endian)!" );
+		
+		std::array<u8,12> constexpr kIdentifier { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+		
+		u64 constexpr kLevelAlignment { 16 }; // NOTE: a multiple of both the block size and 4 (as KTX2 requires)
+		
+		// the start of a KTX2 file (i.e. everything up until the level index):
+		struct Header final {
+			std::array<u8,12> identifier;
+			u32               vkFormat;
+			u32               typeSize;
+			u32               pixelWidth;
+			u32               pixelHeight;
+			u32               pixelDepth;             // 0 for 2D textures
+			u32               layerCount;             // 0 unless an array texture
+			u32               faceCount;              // 6 for cube maps
+			u32               levelCount;             // 0 means that the mip levels should be generated
+			u32               supercompressionScheme;
+			u32               dfdByteOffset;
+			u32               dfdByteLength;
+			u32               kvdByteOffset;
+			u32               kvdByteLength;
+			u64               sgdByteOffset;
+			u64               sgdByteLength;
+		}; // end-of-struct: Header
+		static_assert( sizeof(Header) == 80 );
+		
+		struct LevelIndexEntry final {
+			u64 byteOffset;
+			u64 byteLength;
+			u64 uncompressedByteLength;
+		}; // end-of-struct: LevelIndexEntry
+		static_assert( sizeof(LevelIndexEntry) == 24 );
+		
+		[[nodiscard]] Header
+		readHeader( std::istream &file, std::filesystem::path const &path )
+		{
+			Header header;
+			if ( not file.read( reinterpret_cast<char*>( &header ), sizeof(Header) ) or header.identifier != kIdentifier ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` isn't a KTX2 file!", path.string() ) };
+			return header;
+		} // end-of-function: readHeader
+	} // end-of-unnamed-namespace
+	
+	
+	
+	void
+	TextureFile::loadFile( std::filesystem::path const &path )
+	{
+		std::ifstream file( path, std::ios::binary );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open the texture file `{}`!", path.string() ) };
+		
+		auto const header     { readHeader( file, path ) };
+		auto const fileFormat { static_cast<vk::Format>( header.vkFormat ) };
+		vk::Extent2D const fileExtent { .width = header.pixelWidth, .height = header.pixelHeight };
+		if ( getLevelByteSize( fileFormat, fileExtent ) == 0 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` has an unsupported format (`{}`)!", path.string(), to_string( fileFormat ) ) };
+		if ( fileExtent.width == 0 or fileExtent.height == 0 or header.pixelDepth != 0 or header.layerCount > 1 or header.faceCount != 1 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` isn't a single 2D texture!", path.string() ) };
+		if ( header.supercompressionScheme != 0 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` is supercompressed (which is unsupported)!", path.string() ) };
+		auto const levelCount { std::max( header.levelCount, 1u ) };
+		if ( levelCount > static_cast<u32>( std::bit_width( std::max( fileExtent.width, fileExtent.height ) ) ) ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` has too many mip levels!", path.string() ) };
+		
+		std::vector<LevelIndexEntry> levelIndex( levelCount );
+		if ( not file.read( reinterpret_cast<char*>( levelIndex.data() ), static_cast<std::streamsize>( levelCount * sizeof(LevelIndexEntry) ) ) ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` is truncated!", path.string() ) };
+		
+		std::vector<std::vector<u8>> fileLevels;
+		fileLevels.reserve( levelCount );
+		for ( u32 level{0}; level < levelCount; ++level ) {
+			auto const  byteSize { getLevelByteSize( fileFormat, getLevelExtent( fileExtent, level ) ) };
+			auto const &entry    { levelIndex[level] };
+			if ( entry.byteLength != byteSize ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` has a mip level of the wrong size!", path.string() ) };
+			auto &data { fileLevels.emplace_back( byteSize ) };
+			file.seekg( static_cast<std::streamoff>( entry.byteOffset ) );
+			if ( not file.read( reinterpret_cast<char*>( data.data() ), static_cast<std::streamsize>( byteSize ) ) ) [[unlikely]]
+				throw std::runtime_error { fmt::format( "`{}` is truncated!", path.string() ) };
+		}
+		
+		format = fileFormat;
+		extent = fileExtent;
+		levels = std::move( fileLevels );
+	} // end-of-function: TextureFile::loadFile
+	
+	
+	
+	void
+	TextureFile::saveFile( std::filesystem::path const &path ) const
+	{
+		// pre-condition(s):
+		assert( getLevelByteSize( format, extent ) != 0 and "Unsupported format!" );
+		assert( not levels.empty() );
+		
+		Header const header {
+			.identifier             = kIdentifier,
+			.vkFormat               = static_cast<u32>( format ),
+			.typeSize               = 1, // i.e. for block compressed formats
+			.pixelWidth             = extent.width,
+			.pixelHeight            = extent.height,
+			.pixelDepth             = 0,
+			.layerCount             = 0,
+			.faceCount              = 1,
+			.levelCount             = static_cast<u32>( levels.size() ),
+			.supercompressionScheme = 0,
+			.dfdByteOffset          = 0,
+			.dfdByteLength          = 0,
+			.kvdByteOffset          = 0,
+			.kvdByteLength          = 0,
+			.sgdByteOffset          = 0,
+			.sgdByteLength          = 0
+		};
+		
+		// NOTE: KTX2 stores the levels from the smallest to the largest (while the index starts with the largest):
+		std::vector<LevelIndexEntry> levelIndex( levels.size() );
+		u64 offset { sizeof(Header) + levels.size() * sizeof(LevelIndexEntry) };
+		for ( auto level { levels.size() }; level-- > 0; ) {
+			offset = (offset + kLevelAlignment - 1) / kLevelAlignment * kLevelAlignment;
+			levelIndex[level] = LevelIndexEntry {
+				.byteOffset             = offset,
+				.byteLength             = levels[level].size(),
+				.uncompressedByteLength = levels[level].size()
+			};
+			offset += levels[level].size();
+		}
+		
+		std::ofstream file( path, std::ios::binary );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open `{}` for writing!", path.string() ) };
+		file.write( reinterpret_cast<char const*>( &header ), sizeof(Header) );
+		file.write( reinterpret_cast<char const*>( levelIndex.data() ), static_cast<std::streamsize>( levelIndex.size() * sizeof(LevelIndexEntry) ) );
+		std::array<char,kLevelAlignment> constexpr kPadding {};
+		for ( auto level { levels.size() }; level-- > 0; ) {
+			auto const position { static_cast<u64>( file.tellp() ) };
+			file.write( kPadding.data(), static_cast<std::streamsize>( levelIndex[level].byteOffset - position ) );
+			file.write( reinterpret_cast<char const*>( levels[level].data() ), static_cast<std::streamsize>( levels[level].size() ) );
+		}
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to write `{}`!", path.string() ) };
+	} // end-of-function: TextureFile::saveFile
+	
+	
+	
+	[[nodiscard]] vk::Format
+	TextureFile::readFormat( std::filesystem::path const &path )
+	{
+		std::ifstream file( path, std::ios::binary );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open the texture file `{}`!", path.string() ) };
+		return static_cast<vk::Format>( readHeader( file, path ).vkFormat );
+	} // end-of-function: TextureFile::readFormat
+	
+	
+	
+	[[nodiscard]] u64
+	getLevelByteSize( vk::Format const format, vk::Extent2D const extent ) noexcept
+	{
+		u64 blockByteSize { 0 };
+		if ( auto const blockFormat { getBlockFormat( format ) } )
+			blockByteSize = bc::getBlockByteSize( *blockFormat );
+		else if ( format == vk::Format::eAstc4x4UnormBlock or format == vk::Format::eAstc4x4SrgbBlock )
+			blockByteSize = 16;
+		return u64{ (extent.width + 3) / 4 } * u64{ (extent.height + 3) / 4 } * blockByteSize;
+	} // end-of-function: getLevelByteSize
+	
+	
+	
+	[[nodiscard]] vk::Extent2D
+	getLevelExtent( vk::Extent2D const extent, u32 const level ) noexcept
+	{
+		return vk::Extent2D {
+			.width  = std::max( extent.width  >> level, 1u ),
+			.height = std::max( extent.height >> level, 1u )
+		};
+	} // end-of-function: getLevelExtent
+	
+	
+	
+	[[nodiscard]] std::optional<bc::Format>
+	getBlockFormat( vk::Format const format ) noexcept
+	{
+		switch ( format ) {
+			case vk::Format::eBc1RgbUnormBlock:
+			case vk::Format::eBc1RgbSrgbBlock:
+			case vk::Format::eBc1RgbaUnormBlock:
+			case vk::Format::eBc1RgbaSrgbBlock:  return bc::Format::eBc1;
+			case vk::Format::eBc3UnormBlock:
+			case vk::Format::eBc3SrgbBlock:      return bc::Format::eBc3;
+			case vk::Format::eBc5UnormBlock:     return bc::Format::eBc5;
+			case vk::Format::eBc7UnormBlock:
+			case vk::Format::eBc7SrgbBlock:      return bc::Format::eBc7;
+			default:                             return std::nullopt;
+		}
+	} // end-of-function: getBlockFormat
+	
+	
+	
+	[[nodiscard]] vk::Format
+	getVkFormat( bc::Format const format, bool const isSrgb ) noexcept
+	{
+		switch ( format ) {
+			case bc::Format::eBc1: return isSrgb ? vk::Format::eBc1RgbSrgbBlock : vk::Format::eBc1RgbUnormBlock;
+			case bc::Format::eBc3: return isSrgb ? vk::Format::eBc3SrgbBlock    : vk::Format::eBc3UnormBlock;
+			case bc::Format::eBc5: return vk::Format::eBc5UnormBlock;
+			case bc::Format::eBc7: return isSrgb ? vk::Format::eBc7SrgbBlock    : vk::Format::eBc7UnormBlock;
+		}
+		unreachable();
+	} // end-of-function: getVkFormat
+	
+	
+	
+	[[nodiscard]] bool
+	isSrgb( vk::Format const format ) noexcept
+	{
+		switch ( format ) {
+			case vk::Format::eBc1RgbSrgbBlock:
+			case vk::Format::eBc1RgbaSrgbBlock:
+			case vk::Format::eBc3SrgbBlock:
+			case vk::Format::eBc7SrgbBlock:
+			case vk::Format::eAstc4x4SrgbBlock:
+			case vk::Format::eR8G8B8A8Srgb:
+			case vk::Format::eB8G8R8A8Srgb:      return true;
+			default:                             return false;
+		}
+	} // end-of-function: isSrgb
+} // end-of-namespace: gfx
+// EOF
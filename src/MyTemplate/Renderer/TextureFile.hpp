@@ -0,0 +1,41 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef TEXTUREFILE_HPP_H6PZ3RVC
+#define TEXTUREFILE_HPP_H6PZ3RVC
+
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/BlockCompression.hpp"
+
+#include <vulkan/vulkan.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace gfx {
+	// 2D texture with pre-computed mip levels in a KTX2 container (see: the MyTemplateTextureCompressor tool).
+	// NOTE: Only single layer, single face files without supercompression in the 4x4 block compressed formats
+	//       below are supported. The data format descriptor and key/value data are skipped when reading and
+	//       left out when writing (which makes the written files KTX2-style rather than strictly conformant).
+	//         BC1, BC3, BC5, BC7 (can be decoded on the CPU if the device lacks support; see: `bc::decodeImage`)
+	//         ASTC 4x4           (e.g. from other encoders; can't be decoded on the CPU)
+	struct TextureFile final {
+		vk::Format                   format { vk::Format::eUndefined };
+		vk::Extent2D                 extent {                        };
+		std::vector<std::vector<u8>> levels {                        }; // the first (i.e. full extent) level first
+		
+		void loadFile( std::filesystem::path const & ); // throws if the file is malformed or unsupported
+		void saveFile( std::filesystem::path const & ) const;
+		
+		// reads just the format of a file (e.g. to pick between several encodings of a texture):
+		[[nodiscard]] static vk::Format readFormat( std::filesystem::path const & );
+	}; // end-of-struct: TextureFile
+	
+	[[nodiscard]] u64                       getLevelByteSize( vk::Format const, vk::Extent2D const ) noexcept; // 0 if unsupported
+	[[nodiscard]] vk::Extent2D              getLevelExtent(   vk::Extent2D const, u32 const level  ) noexcept;
+	[[nodiscard]] std::optional<bc::Format> getBlockFormat(   vk::Format const                     ) noexcept; // if decodable
+	[[nodiscard]] vk::Format                getVkFormat(      bc::Format const, bool const isSrgb  ) noexcept; // BC5 is never sRGB
+	[[nodiscard]] bool                      isSrgb(           vk::Format const                     ) noexcept;
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard TEXTUREFILE_HPP_H6PZ3RVC
+// EOF
@@ -0,0 +1,140 @@
+#include "MyTemplate/Renderer/UniformRing.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+#include <utility>
+#include <cassert>
+
+namespace gfx {
+	UniformRing::UniformRing(
+		vk::raii::Device              const &device,
+		std::unique_ptr<Buffer>              pBuffer,
+		vk::raii::DescriptorSetLayout const &descriptorSetLayout,
+		std::span<vk::DeviceSize const>      bindingRanges,
+		vk::DeviceSize                const  regionSize,
+		u32                           const  regionCount,
+		vk::DeviceSize                const  alignment
+	):
+		mpBuffer         { std::move( pBuffer ) },
+		mpDescriptorPool {                      },
+		mpDescriptorSets {                      },
+		mRegionSize      { regionSize           },
+		mAlignment       { alignment            },
+		mHeads           ( regionCount, 0       )
+	{
+		spdlog::info( "Constructing a UniformRing instance ({} region(s) of {} bytes)...", regionCount, regionSize );
+		
+		// pre-condition(s):
+		//   the regions have to start at valid dynamic offsets:
+		assert( alignment > 0 and regionSize % alignment == 0 );
+		assert( not bindingRanges.empty() );
+		
+		if ( mpBuffer == nullptr or mpBuffer->allocation.getMappedData() == nullptr ) [[unlikely]]
+			throw std::runtime_error { "Uniform ring buffer must be host visible!" };
+		
+		vk::DescriptorPoolSize const poolSize {
+			.type            = vk::DescriptorType::eUniformBufferDynamic,
+			.descriptorCount = static_cast<u32>( bindingRanges.size() )
+		};
+		mpDescriptorPool = std::make_unique<vk::raii::DescriptorPool>(
+			device,
+			vk::DescriptorPoolCreateInfo {
+				.flags         =  vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet, // the RAII set frees itself
+				.maxSets       =  1,
+				.poolSizeCount =  1,
+				.pPoolSizes    = &poolSize
+			}
+		);
+		mpDescriptorSets = std::make_unique<vk::raii::DescriptorSets>(
+			device,
+			vk::DescriptorSetAllocateInfo {
+				.descriptorPool     = **mpDescriptorPool,
+				.descriptorSetCount =   1,
+				.pSetLayouts        =  &*descriptorSetLayout
+			}
+		);
+		
+		std::vector<vk::DescriptorBufferInfo>  bufferInfos;
+		std::vector<vk::WriteDescriptorSet>    writes;
+		bufferInfos.reserve( bindingRanges.size() );
+		writes.reserve(      bindingRanges.size() );
+		for ( u32 binding{0}; binding < bindingRanges.size(); ++binding ) {
+			bufferInfos.push_back(
+				vk::DescriptorBufferInfo {
+					.buffer = *mpBuffer->handle,
+					.offset =  0, // NOTE: added to the dynamic offset
+					.range  =  bindingRanges[binding]
+				}
+			);
+			writes.push_back(
+				vk::WriteDescriptorSet {
+					.dstSet          = *(*mpDescriptorSets)[0],
+					.dstBinding      =  binding,
+					.dstArrayElement =  0,
+					.descriptorCount =  1,
+					.descriptorType  =  vk::DescriptorType::eUniformBufferDynamic,
+					.pBufferInfo     = &bufferInfos.back()
+				}
+			);
+		}
+		device.updateDescriptorSets( writes, {} );
+	} // end-of-function: UniformRing::UniformRing
+	
+	
+	
+	[[nodiscard]] std::optional<UniformRing::Slice>
+	UniformRing::allocate( u32 const frameSlot, vk::DeviceSize const size ) noexcept
+	{
+		// pre-condition(s):
+		assert( frameSlot < mHeads.size() );
+		
+		auto &head { mHeads[frameSlot] };
+		auto const alignedSize { getAlignedSize( size ) };
+		if ( head + alignedSize > mRegionSize ) [[unlikely]]
+			return std::nullopt;
+		auto const offset { frameSlot * mRegionSize + head };
+		head += alignedSize;
+		return Slice {
+			.offset = static_cast<u32>( offset ),
+			.pData  = static_cast<char *>( mpBuffer->allocation.getMappedData() ) + offset
+		};
+	} // end-of-function: UniformRing::allocate
+	
+	
+	
+	void
+	UniformRing::beginFrame( u32 const frameSlot ) noexcept
+	{
+		// pre-condition(s):
+		assert( frameSlot < mHeads.size() );
+		
+		mHeads[frameSlot] = 0;
+	} // end-of-function: UniformRing::beginFrame
+	
+	
+	
+	[[nodiscard]] vk::DeviceSize
+	UniformRing::getAlignedSize( vk::DeviceSize const size ) const noexcept
+	{
+		return (size + mAlignment - 1) / mAlignment * mAlignment;
+	} // end-of-function: UniformRing::getAlignedSize
+	
+	
+	
+	[[nodiscard]] vk::DeviceSize
+	UniformRing::getRegionSize() const noexcept
+	{
+		return mRegionSize;
+	} // end-of-function: UniformRing::getRegionSize
+	
+	
+	
+	[[nodiscard]] vk::DescriptorSet
+	UniformRing::getDescriptorSet() const noexcept
+	{
+		return *(*mpDescriptorSets)[0];
+	} // end-of-function: UniformRing::getDescriptorSet
+} // end-of-namespace: gfx
+// EOF
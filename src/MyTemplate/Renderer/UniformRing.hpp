@@ -0,0 +1,58 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef UNIFORMRING_HPP_R8VN4HJD
+#define UNIFORMRING_HPP_R8VN4HJD
+
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace gfx {
+	// Persistently mapped host visible buffer for per frame uniform data, split into one region per frame slot.
+	// NOTE: The descriptor set is written once at construction with every binding pointing at the start of the
+	//       buffer; draws select their data with dynamic offsets instead, so there are never any descriptor
+	//       updates (nor mapping calls) per frame or per draw.
+	class UniformRing final {
+		public:
+			struct Slice final {
+				u32   offset; // i.e. a dynamic offset
+				void *pData;  // mapped pointer to the start of the slice
+			}; // end-of-struct: UniformRing::Slice
+			
+			UniformRing(
+				vk::raii::Device              const &,
+				std::unique_ptr<Buffer>              pBuffer,
+				vk::raii::DescriptorSetLayout const &,
+				std::span<vk::DeviceSize const>      bindingRanges, // one uniform buffer dynamic binding each
+				vk::DeviceSize                const  regionSize,
+				u32                           const  regionCount,
+				vk::DeviceSize                const  alignment      // i.e. `minUniformBufferOffsetAlignment`
+			);
+			UniformRing(             UniformRing const &  ) = delete;
+			UniformRing(             UniformRing       && ) = delete;
+			UniformRing & operator=( UniformRing const &  ) = delete;
+			UniformRing & operator=( UniformRing       && ) = delete;
+			
+			[[nodiscard]] std::optional<Slice>    allocate( u32 const frameSlot, vk::DeviceSize const size ) noexcept;
+			void                                  beginFrame( u32 const frameSlot ) noexcept; // call after the slot's previous frame has completed
+			[[nodiscard]] vk::DeviceSize          getAlignedSize( vk::DeviceSize const size ) const noexcept;
+			[[nodiscard]] vk::DeviceSize          getRegionSize()                             const noexcept;
+			[[nodiscard]] vk::DescriptorSet       getDescriptorSet()                          const noexcept;
+		
+		private:
+			std::unique_ptr<Buffer>                   mpBuffer;
+			std::unique_ptr<vk::raii::DescriptorPool> mpDescriptorPool;
+			std::unique_ptr<vk::raii::DescriptorSets> mpDescriptorSets; // NOTE: Must be deleted before the pool!
+			vk::DeviceSize                            mRegionSize;
+			vk::DeviceSize                            mAlignment;
+			std::vector<vk::DeviceSize>               mHeads;           // bump offset within each region
+	}; // end-of-class: UniformRing
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard UNIFORMRING_HPP_R8VN4HJD
+// EOF
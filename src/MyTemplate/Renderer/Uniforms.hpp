@@ -0,0 +1,22 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef UNIFORMS_HPP_T3KW9QZC
+#define UNIFORMS_HPP_T3KW9QZC
+
+#include <glm/ext/matrix_float4x4.hpp>
+
+namespace gfx {
+	// NOTE: These mirror the uniform blocks of the vertex shader (std140), so the layouts have to be kept in sync.
+	
+	// Written once per frame; shared by all of the frame's draws (set 0, binding 0).
+	struct CameraUniforms final {
+		glm::mat4 viewProjection { 1.0f };
+	}; // end-of-struct: CameraUniforms
+	
+	// Written once per draw (set 0, binding 1).
+	struct ObjectUniforms final {
+		glm::mat4 model { 1.0f };
+	}; // end-of-struct: ObjectUniforms
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard UNIFORMS_HPP_T3KW9QZC
+// EOF
@@ -0,0 +1,600 @@
+#include "MyTemplate/Renderer/UploadService.hpp"
+#include "MyTemplate/Renderer/common.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/utility.hpp"
+#include "MyTemplate/Common/Logging.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <cassert>
+
+namespace gfx {
+	namespace { // private (file-scope)
+		// TODO(config): refactor
+		u32                      constexpr kBatchCount      { 4        }; // max number of batches in flight
+		u64                      constexpr kWaitTimeout     { max<u64> };
+		// NOTE: uploaded buffers are consumed as vertex, index, or uniform data:
+		vk::PipelineStageFlags   constexpr kConsumerStages  { vk::PipelineStageFlagBits::eVertexInput
+		                                                    | vk::PipelineStageFlagBits::eVertexShader
+		                                                    | vk::PipelineStageFlagBits::eFragmentShader };
+		vk::AccessFlags          constexpr kConsumerAccess  { vk::AccessFlagBits::eVertexAttributeRead
+		                                                    | vk::AccessFlagBits::eIndexRead
+		                                                    | vk::AccessFlagBits::eUniformRead
+		                                                    | vk::AccessFlagBits::eShaderRead };
+		// NOTE: uploaded images are only ever sampled:
+		vk::ImageLayout          constexpr kConsumerLayout  { vk::ImageLayout::eShaderReadOnlyOptimal    };
+		
+		[[nodiscard]] vk::Offset3D
+		getMipExtent( vk::Extent2D const extent, u32 const mipLevel ) noexcept
+		{
+			return vk::Offset3D {
+				.x = static_cast<i32>( std::max( extent.width  >> mipLevel, 1u ) ),
+				.y = static_cast<i32>( std::max( extent.height >> mipLevel, 1u ) ),
+				.z = 1
+			};
+		} // end-of-function: getMipExtent
+	} // end-of-unnamed-namespace
+	
+	
+	
+	struct UploadService::Batch final {
+		// NOTE: image copies are only recorded on flush, so that their layout transitions are batched
+		struct ImageCopy final {
+			vk::Buffer                   src;
+			vk::Image                    dst;
+			vk::ImageSubresourceRange    subresourceRange;
+			u64                          firstRegion; // into `imageCopyRegions`
+			u64                          regionCount;
+			std::optional<MipGeneration> mipGeneration;
+		}; // end-of-struct: UploadService::Batch::ImageCopy
+		
+		vk::raii::CommandPool                transferCommandPool;
+		vk::raii::CommandBuffer              transferCommandBuffer;
+		vk::raii::CommandPool                graphicsCommandPool;   // only used for ownership acquisition
+		vk::raii::CommandBuffer              graphicsCommandBuffer; // ditto
+		vk::raii::Semaphore                  ownershipReleased;     // ditto
+		vk::raii::Fence                      completed;
+		std::vector<vk::BufferMemoryBarrier> ownershipBarriers;
+		std::vector<vk::ImageMemoryBarrier>  imageBarriers;         // layout transitions (and ownership transfers) after the copies
+		std::vector<ImageCopy>               imageCopies;
+		std::vector<vk::BufferImageCopy>     imageCopyRegions;
+		std::vector<ImageCopy>               mipChains;             // copied images whose mip levels are still to be generated
+		std::vector<std::unique_ptr<Buffer>> retained;
+		u64                                  id;
+		u32                                  copyCount;
+		bool                                 isRecording;
+		bool                                 isInFlight;
+	}; // end-of-struct: UploadService::Batch
+	
+	
+	
+	UploadService::UploadService(
+		vk::raii::Device   const &device,
+		vk::raii::Queue    const &transferQueue,
+		vk::raii::Queue    const &graphicsQueue,
+		QueueFamilyIndices const &queueFamilyIndices
+	):
+		mpDevice               { &device                                                                  },
+		mpTransferQueue        { &transferQueue                                                           },
+		mpGraphicsQueue        { &graphicsQueue                                                           },
+		mQueueFamilyIndices    {  queueFamilyIndices                                                      },
+		mNeedsOwnershipTransfer{  queueFamilyIndices.transferIndex != queueFamilyIndices.graphicsIndex    },
+		mBatches               {                                                                          },
+		mRecordingIndex        {  0                                                                       },
+		mNextBatchId           {  1                                                                       },
+		mLastSubmittedId       {  0                                                                       }
+	{
+		spdlog::info( "Constructing an UploadService instance..." );
+		spdlog::info( "... queue family ownership transfer: {}", mNeedsOwnershipTransfer ? "required" : "not required" );
+		
+		auto const makeCommandBuffer {
+			[&device]( vk::raii::CommandPool const &pool ) {
+				return std::move(
+					vk::raii::CommandBuffers(
+						device,
+						vk::CommandBufferAllocateInfo {
+							.commandPool        = *pool,
+							.level              =  vk::CommandBufferLevel::ePrimary,
+							.commandBufferCount =  1
+						}
+					).front()
+				);
+			}
+		};
+		
+		mBatches.reserve( kBatchCount );
+		for ( u32 i{0};  i < kBatchCount;  ++i ) {
+			auto transferCommandPool {
+				vk::raii::CommandPool(
+					device,
+					vk::CommandPoolCreateInfo {
+						.flags            = vk::CommandPoolCreateFlagBits::eTransient,
+						.queueFamilyIndex = mQueueFamilyIndices.transferIndex
+					}
+				)
+			};
+			auto graphicsCommandPool {
+				vk::raii::CommandPool(
+					device,
+					vk::CommandPoolCreateInfo {
+						.flags            = vk::CommandPoolCreateFlagBits::eTransient,
+						.queueFamilyIndex = mQueueFamilyIndices.graphicsIndex
+					}
+				)
+			};
+			auto transferCommandBuffer { makeCommandBuffer( transferCommandPool ) };
+			auto graphicsCommandBuffer { makeCommandBuffer( graphicsCommandPool ) };
+			mBatches.push_back(
+				std::make_unique<Batch>(
+					std::move( transferCommandPool   ),
+					std::move( transferCommandBuffer ),
+					std::move( graphicsCommandPool   ),
+					std::move( graphicsCommandBuffer ),
+					device.createSemaphore( {} ),
+					device.createFence( {} ),
+					std::vector<vk::BufferMemoryBarrier>{},
+					std::vector<vk::ImageMemoryBarrier>{},
+					std::vector<Batch::ImageCopy>{},
+					std::vector<vk::BufferImageCopy>{},
+					std::vector<Batch::ImageCopy>{},
+					std::vector<std::unique_ptr<Buffer>>{},
+					0, 0, false, false
+				)
+			);
+		}
+	} // end-of-function: UploadService::UploadService
+	
+	
+	
+	UploadService::~UploadService() noexcept
+	{
+		spdlog::info( "Destroying an UploadService instance..." );
+		try {
+			for ( auto &pBatch: mBatches )
+				if ( pBatch->isInFlight )
+					waitForBatch( *pBatch );
+		}
+		catch ( vk::SystemError const &e ) {
+			spdlog::error( "Encountered system error: \"{}\"!", e.what() );
+		}
+	} // end-of-function: UploadService::~UploadService
+	
+	
+	
+	[[nodiscard]] UploadService::Batch &
+	UploadService::getRecordingBatch()
+	{
+		auto &batch { *mBatches[mRecordingIndex] };
+		if ( batch.isRecording ) [[likely]]
+			return batch;
+		
+		if ( batch.isInFlight ) [[unlikely]] // ring is full; wait for the oldest batch
+			waitForBatch( batch );
+		
+		batch.transferCommandPool.reset( {} );
+		batch.graphicsCommandPool.reset( {} );
+		batch.transferCommandBuffer.begin({ .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+		batch.id          = mNextBatchId++;
+		batch.copyCount   = 0;
+		batch.isRecording = true;
+		return batch;
+	} // end-of-function: UploadService::getRecordingBatch
+	
+	
+	
+	[[nodiscard]] UploadTicket
+	UploadService::enqueueCopy(
+		vk::Buffer     const src, vk::DeviceSize const srcOffset,
+		vk::Buffer     const dst, vk::DeviceSize const dstOffset,
+		vk::DeviceSize const size
+	)
+	{
+		auto &batch { getRecordingBatch() };
+		batch.transferCommandBuffer.copyBuffer(
+			src, dst,
+			vk::BufferCopy {
+				.srcOffset = srcOffset,
+				.dstOffset = dstOffset,
+				.size      = size
+			}
+		);
+		if ( mNeedsOwnershipTransfer ) [[likely]] {
+			// NOTE: the same barrier is recorded twice; once to release (transfer) and once to acquire (graphics)
+			batch.ownershipBarriers.push_back(
+				vk::BufferMemoryBarrier {
+					.srcAccessMask       = vk::AccessFlagBits::eTransferWrite,
+					.dstAccessMask       = kConsumerAccess,
+					.srcQueueFamilyIndex = mQueueFamilyIndices.transferIndex,
+					.dstQueueFamilyIndex = mQueueFamilyIndices.graphicsIndex,
+					.buffer              = dst,
+					.offset              = dstOffset,
+					.size                = size
+				}
+			);
+		}
+		++batch.copyCount;
+		return { .batchId = batch.id };
+	} // end-of-function: UploadService::enqueueCopy
+	
+	
+	
+	[[nodiscard]] UploadTicket
+	UploadService::enqueueImageCopy(
+		vk::Buffer                    const  src,
+		vk::Image                     const  dst,
+		vk::ImageSubresourceRange     const &subresourceRange,
+		std::span<vk::BufferImageCopy const> regions,
+		std::optional<MipGeneration>  const  mipGeneration
+	)
+	{
+		// pre-condition(s):
+		//   the mip chain is blitted from the first level of the range:
+		assert( not mipGeneration or subresourceRange.baseMipLevel == 0 );
+		
+		auto &batch { getRecordingBatch() };
+		batch.imageCopies.push_back(
+			Batch::ImageCopy {
+				.src              = src,
+				.dst              = dst,
+				.subresourceRange = subresourceRange,
+				.firstRegion      = batch.imageCopyRegions.size(),
+				.regionCount      = regions.size(),
+				.mipGeneration    = mipGeneration
+			}
+		);
+		batch.imageCopyRegions.insert( batch.imageCopyRegions.end(), regions.begin(), regions.end() );
+		++batch.copyCount;
+		return { .batchId = batch.id };
+	} // end-of-function: UploadService::enqueueImageCopy
+	
+	
+	
+	void
+	UploadService::recordImageCopies( Batch &batch )
+	{
+		if ( batch.imageCopies.empty() ) [[likely]]
+			return;
+		
+		// one barrier for all images to enter the transfer destination layout:
+		std::vector<vk::ImageMemoryBarrier> transferBarriers;
+		transferBarriers.reserve( batch.imageCopies.size() );
+		for ( auto const &imageCopy: batch.imageCopies ) {
+			transferBarriers.push_back(
+				vk::ImageMemoryBarrier {
+					.srcAccessMask       = {},
+					.dstAccessMask       = vk::AccessFlagBits::eTransferWrite,
+					.oldLayout           = vk::ImageLayout::eUndefined, // i.e. discard
+					.newLayout           = vk::ImageLayout::eTransferDstOptimal,
+					.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+					.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+					.image               = imageCopy.dst,
+					.subresourceRange    = imageCopy.subresourceRange
+				}
+			);
+		}
+		batch.transferCommandBuffer.pipelineBarrier(
+			vk::PipelineStageFlagBits::eTopOfPipe,
+			vk::PipelineStageFlagBits::eTransfer,
+			{}, nullptr, nullptr, transferBarriers
+		);
+		
+		// the copies, followed by the transitions into the consumer layout (submitted along with the buffer barriers):
+		for ( auto const &imageCopy: batch.imageCopies ) {
+			batch.transferCommandBuffer.copyBufferToImage(
+				imageCopy.src,
+				imageCopy.dst,
+				vk::ImageLayout::eTransferDstOptimal,
+				vk::ArrayProxy<vk::BufferImageCopy const>(
+					static_cast<u32>( imageCopy.regionCount ),
+					batch.imageCopyRegions.data() + imageCopy.firstRegion
+				)
+			);
+			if ( imageCopy.mipGeneration ) {
+				// NOTE: the blits need a graphics queue, so the image is handed over as is (if need be)
+				//       and only transitioned into the consumer layout once its mip chain is complete
+				batch.mipChains.push_back( imageCopy );
+				if ( mNeedsOwnershipTransfer ) [[likely]] {
+					batch.imageBarriers.push_back(
+						vk::ImageMemoryBarrier {
+							.srcAccessMask       = vk::AccessFlagBits::eTransferWrite,
+							.dstAccessMask       = vk::AccessFlagBits::eTransferRead | vk::AccessFlagBits::eTransferWrite,
+							.oldLayout           = vk::ImageLayout::eTransferDstOptimal,
+							.newLayout           = vk::ImageLayout::eTransferDstOptimal,
+							.srcQueueFamilyIndex = mQueueFamilyIndices.transferIndex,
+							.dstQueueFamilyIndex = mQueueFamilyIndices.graphicsIndex,
+							.image               = imageCopy.dst,
+							.subresourceRange    = imageCopy.subresourceRange
+						}
+					);
+				}
+				continue;
+			}
+			batch.imageBarriers.push_back(
+				vk::ImageMemoryBarrier {
+					.srcAccessMask       = vk::AccessFlagBits::eTransferWrite,
+					.dstAccessMask       = kConsumerAccess,
+					.oldLayout           = vk::ImageLayout::eTransferDstOptimal,
+					.newLayout           = kConsumerLayout,
+					.srcQueueFamilyIndex = mNeedsOwnershipTransfer ? mQueueFamilyIndices.transferIndex : VK_QUEUE_FAMILY_IGNORED,
+					.dstQueueFamilyIndex = mNeedsOwnershipTransfer ? mQueueFamilyIndices.graphicsIndex : VK_QUEUE_FAMILY_IGNORED,
+					.image               = imageCopy.dst,
+					.subresourceRange    = imageCopy.subresourceRange
+				}
+			);
+		}
+		batch.imageCopies.clear();
+		batch.imageCopyRegions.clear();
+	} // end-of-function: UploadService::recordImageCopies
+	
+	
+	
+	void
+	UploadService::recordMipChains( Batch &batch, vk::raii::CommandBuffer &commandBuffer )
+	{
+		if ( batch.mipChains.empty() ) [[likely]]
+			return;
+		
+		// NOTE: The chains are generated level by level for all images at once, so there is one barrier per
+		//       mip level (rather than one per image and mip level) between the blits that depend on each other.
+		u32 levelCount { 0 };
+		for ( auto const &chain: batch.mipChains )
+			levelCount = std::max( levelCount, chain.subresourceRange.levelCount );
+		
+		std::vector<vk::ImageMemoryBarrier> barriers;
+		barriers.reserve( batch.mipChains.size() );
+		for ( u32 level{1}; level < levelCount; ++level ) {
+			// the previous level has been written (by the copy or the previous blit); read from it from here on:
+			barriers.clear();
+			for ( auto const &chain: batch.mipChains ) {
+				if ( level >= chain.subresourceRange.levelCount )
+					continue;
+				barriers.push_back(
+					vk::ImageMemoryBarrier {
+						.srcAccessMask       = vk::AccessFlagBits::eTransferWrite,
+						.dstAccessMask       = vk::AccessFlagBits::eTransferRead,
+						.oldLayout           = vk::ImageLayout::eTransferDstOptimal,
+						.newLayout           = vk::ImageLayout::eTransferSrcOptimal,
+						.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+						.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+						.image               = chain.dst,
+						.subresourceRange    = vk::ImageSubresourceRange {
+						                          .aspectMask     = chain.subresourceRange.aspectMask,
+						                          .baseMipLevel   = level - 1,
+						                          .levelCount     = 1,
+						                          .baseArrayLayer = chain.subresourceRange.baseArrayLayer,
+						                          .layerCount     = chain.subresourceRange.layerCount
+						                       }
+					}
+				);
+			}
+			commandBuffer.pipelineBarrier(
+				vk::PipelineStageFlagBits::eTransfer,
+				vk::PipelineStageFlagBits::eTransfer,
+				{}, nullptr, nullptr, barriers
+			);
+			for ( auto const &chain: batch.mipChains ) {
+				if ( level >= chain.subresourceRange.levelCount )
+					continue;
+				auto const &range { chain.subresourceRange };
+				commandBuffer.blitImage(
+					chain.dst, vk::ImageLayout::eTransferSrcOptimal,
+					chain.dst, vk::ImageLayout::eTransferDstOptimal,
+					vk::ImageBlit {
+						.srcSubresource = { range.aspectMask, level - 1, range.baseArrayLayer, range.layerCount },
+						.srcOffsets     = std::array { vk::Offset3D {}, getMipExtent( chain.mipGeneration->extent, level - 1 ) },
+						.dstSubresource = { range.aspectMask, level,     range.baseArrayLayer, range.layerCount },
+						.dstOffsets     = std::array { vk::Offset3D {}, getMipExtent( chain.mipGeneration->extent, level     ) }
+					},
+					chain.mipGeneration->filter
+				);
+			}
+		}
+		
+		// every level but the last one is now a transfer source; transition them all into the consumer layout:
+		barriers.clear();
+		for ( auto const &chain: batch.mipChains ) {
+			auto const &range { chain.subresourceRange };
+			auto const  makeBarrier {
+				[&]( vk::ImageLayout const oldLayout, u32 const baseMipLevel, u32 const mipLevelCount ) {
+					return vk::ImageMemoryBarrier {
+						.srcAccessMask       = vk::AccessFlagBits::eTransferRead | vk::AccessFlagBits::eTransferWrite,
+						.dstAccessMask       = kConsumerAccess,
+						.oldLayout           = oldLayout,
+						.newLayout           = kConsumerLayout,
+						.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+						.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+						.image               = chain.dst,
+						.subresourceRange    = vk::ImageSubresourceRange {
+						                          .aspectMask     = range.aspectMask,
+						                          .baseMipLevel   = baseMipLevel,
+						                          .levelCount     = mipLevelCount,
+						                          .baseArrayLayer = range.baseArrayLayer,
+						                          .layerCount     = range.layerCount
+						                       }
+					};
+				}
+			};
+			if ( range.levelCount > 1 )
+				barriers.push_back( makeBarrier( vk::ImageLayout::eTransferSrcOptimal, 0, range.levelCount - 1 ) );
+			barriers.push_back( makeBarrier( vk::ImageLayout::eTransferDstOptimal, range.levelCount - 1, 1 ) );
+		}
+		commandBuffer.pipelineBarrier(
+			vk::PipelineStageFlagBits::eTransfer,
+			kConsumerStages,
+			{}, nullptr, nullptr, barriers
+		);
+		LOG_DEBUG( "Generated the mip chains of {} image(s) in upload batch #{}", batch.mipChains.size(), batch.id );
+		batch.mipChains.clear();
+	} // end-of-function: UploadService::recordMipChains
+	
+	
+	
+	void
+	UploadService::retain( std::unique_ptr<Buffer> pBuffer )
+	{
+		getRecordingBatch().retained.push_back( std::move( pBuffer ) );
+	} // end-of-function: UploadService::retain
+	
+	
+	
+	UploadTicket
+	UploadService::flush()
+	{
+		auto &batch { *mBatches[mRecordingIndex] };
+		if ( not batch.isRecording or batch.copyCount == 0 ) [[likely]]
+			return { .batchId = mLastSubmittedId };
+		
+		LOG_DEBUG( "Submitting upload batch #{} with {} copies...", batch.id, batch.copyCount );
+		recordImageCopies( batch );
+		
+		if ( mNeedsOwnershipTransfer ) [[likely]] {
+			// release on the transfer queue (the dst access mask is ignored for releases):
+			for ( auto &barrier: batch.ownershipBarriers )
+				barrier.dstAccessMask = {};
+			for ( auto &barrier: batch.imageBarriers )
+				barrier.dstAccessMask = {};
+			batch.transferCommandBuffer.pipelineBarrier(
+				vk::PipelineStageFlagBits::eTransfer,
+				vk::PipelineStageFlagBits::eBottomOfPipe,
+				{}, nullptr, batch.ownershipBarriers, batch.imageBarriers
+			);
+			batch.transferCommandBuffer.end();
+			mpTransferQueue->submit(
+				vk::SubmitInfo {
+					.commandBufferCount   =  1,
+					.pCommandBuffers      = &*batch.transferCommandBuffer,
+					.signalSemaphoreCount =  1,
+					.pSignalSemaphores    = &*batch.ownershipReleased
+				}
+			);
+			// acquire on the graphics queue (the src access mask is ignored for acquisitions):
+			for ( auto &barrier: batch.ownershipBarriers ) {
+				barrier.srcAccessMask = {};
+				barrier.dstAccessMask = kConsumerAccess;
+			}
+			for ( auto &barrier: batch.imageBarriers ) {
+				barrier.srcAccessMask = {};
+				barrier.dstAccessMask = kConsumerAccess;
+			}
+			for ( auto &barrier: batch.imageBarriers )
+				if ( barrier.newLayout == vk::ImageLayout::eTransferDstOptimal ) // i.e. the mip chain is generated next
+					barrier.dstAccessMask = vk::AccessFlagBits::eTransferRead | vk::AccessFlagBits::eTransferWrite;
+			batch.graphicsCommandBuffer.begin({ .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+			batch.graphicsCommandBuffer.pipelineBarrier(
+				vk::PipelineStageFlagBits::eAllCommands, // chains with the semaphore wait below
+				kConsumerStages | vk::PipelineStageFlagBits::eTransfer,
+				{}, nullptr, batch.ownershipBarriers, batch.imageBarriers
+			);
+			recordMipChains( batch, batch.graphicsCommandBuffer );
+			batch.graphicsCommandBuffer.end();
+			vk::PipelineStageFlags const waitStage { vk::PipelineStageFlagBits::eAllCommands };
+			mpGraphicsQueue->submit(
+				vk::SubmitInfo {
+					.waitSemaphoreCount = 1,
+					.pWaitSemaphores    = &*batch.ownershipReleased,
+					.pWaitDstStageMask  = &waitStage,
+					.commandBufferCount = 1,
+					.pCommandBuffers    = &*batch.graphicsCommandBuffer
+				},
+				*batch.completed
+			);
+		}
+		else [[unlikely]] {
+			// same queue family; a plain memory barrier makes the copies visible to later submissions:
+			vk::MemoryBarrier const barrier {
+				.srcAccessMask = vk::AccessFlagBits::eTransferWrite,
+				.dstAccessMask = kConsumerAccess
+			};
+			batch.transferCommandBuffer.pipelineBarrier(
+				vk::PipelineStageFlagBits::eTransfer,
+				kConsumerStages,
+				{}, barrier, nullptr, batch.imageBarriers // NOTE: the image barriers also transition the layouts
+			);
+			recordMipChains( batch, batch.transferCommandBuffer ); // NOTE: same family, so the queue supports blits
+			batch.transferCommandBuffer.end();
+			mpTransferQueue->submit(
+				vk::SubmitInfo {
+					.commandBufferCount = 1,
+					.pCommandBuffers    = &*batch.transferCommandBuffer
+				},
+				*batch.completed
+			);
+		}
+		
+		batch.ownershipBarriers.clear();
+		batch.imageBarriers.clear();
+		batch.isRecording = false;
+		batch.isInFlight  = true;
+		mLastSubmittedId  = batch.id;
+		mRecordingIndex   = (mRecordingIndex + 1) % kBatchCount;
+		return { .batchId = batch.id };
+	} // end-of-function: UploadService::flush
+	
+	
+	
+	void
+	UploadService::recycle( Batch &batch )
+	{
+		batch.retained.clear(); // releases staging buffers
+		batch.isInFlight = false;
+	} // end-of-function: UploadService::recycle
+	
+	
+	
+	void
+	UploadService::waitForBatch( Batch &batch )
+	{
+		assert( batch.isInFlight );
+		auto const waitResult { mpDevice->waitForFences( *batch.completed, VK_TRUE, kWaitTimeout ) };
+		if ( waitResult != vk::Result::eSuccess ) [[unlikely]]
+			throw std::runtime_error { "Upload fence wait timed out!" };
+		mpDevice->resetFences( *batch.completed );
+		recycle( batch );
+	} // end-of-function: UploadService::waitForBatch
+	
+	
+	
+	void
+	UploadService::collect()
+	{
+		for ( auto &pBatch: mBatches ) {
+			if ( pBatch->isInFlight and pBatch->completed.getStatus() == vk::Result::eSuccess ) {
+				mpDevice->resetFences( *pBatch->completed );
+				recycle( *pBatch );
+			}
+		}
+	} // end-of-function: UploadService::collect
+	
+	
+	
+	[[nodiscard]] bool
+	UploadService::isComplete( UploadTicket const ticket )
+	{
+		if ( ticket.batchId > mLastSubmittedId ) [[unlikely]]
+			return false; // still being recorded
+		collect();
+		return std::ranges::none_of(
+			mBatches,
+			[ticket]( auto const &pBatch ) { return pBatch->isInFlight and pBatch->id <= ticket.batchId; }
+		);
+	} // end-of-function: UploadService::isComplete
+	
+	
+	
+	void
+	UploadService::wait( UploadTicket const ticket )
+	{
+		if ( ticket.batchId > mLastSubmittedId ) [[unlikely]]
+			flush();
+		for ( auto &pBatch: mBatches )
+			if ( pBatch->isInFlight and pBatch->id <= ticket.batchId )
+				waitForBatch( *pBatch );
+	} // end-of-function: UploadService::wait
+} // end-of-namespace: gfx
+// EOF
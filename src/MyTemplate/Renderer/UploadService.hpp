@@ -0,0 +1,90 @@
+#pragma once // potentially faster compile-times if supported
+#ifndef UPLOADSERVICE_HPP_T8VJ4NCA
+#define UPLOADSERVICE_HPP_T8VJ4NCA
+
+#include "MyTemplate/Renderer/common.hpp"
+
+#include <vulkan/vulkan.hpp>
+#include <vulkan/vulkan_raii.hpp>
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace gfx {
+	// Identifies the batch an upload was recorded into; cheap to copy and compare.
+	struct UploadTicket final {
+		u64 batchId { 0 }; // 0 = nothing to wait for
+	}; // end-of-struct: UploadTicket
+	
+	
+	
+	// Fills every mip level after the first of an uploaded 2D image by blitting each level from the previous one.
+	struct MipGeneration final {
+		vk::Extent2D extent {                    }; // of the first mip level
+		vk::Filter   filter { vk::Filter::eLinear }; // NOTE: requires `eSampledImageFilterLinear` support for the format
+	}; // end-of-struct: MipGeneration
+	
+	
+	
+	// Batches transfer-queue copies into one command buffer per flush and hands ownership
+	// of the destination buffers (and images) over to the graphics queue family once the copies are done.
+	class UploadService final {
+		public:
+			UploadService(
+				vk::raii::Device   const &,
+				vk::raii::Queue    const &transferQueue,
+				vk::raii::Queue    const &graphicsQueue,
+				QueueFamilyIndices const &
+			);
+			~UploadService() noexcept;
+			UploadService(             UploadService const &  ) = delete;
+			UploadService(             UploadService       && ) = delete;
+			UploadService & operator=( UploadService const &  ) = delete;
+			UploadService & operator=( UploadService       && ) = delete;
+			
+			// records a copy into the currently open batch:
+			[[nodiscard]] UploadTicket enqueueCopy(
+				vk::Buffer     const src, vk::DeviceSize const srcOffset,
+				vk::Buffer     const dst, vk::DeviceSize const dstOffset,
+				vk::DeviceSize const size
+			);
+			// records a copy into (the given subresources of) an image that ends up in `eShaderReadOnlyOptimal` layout;
+			// the previous contents are discarded. With mip generation, only the first level has to be copied
+			// (the image then needs `eTransferSrc` usage; the blits run on the queue that acquires ownership):
+			[[nodiscard]] UploadTicket enqueueImageCopy(
+				vk::Buffer                    const  src,
+				vk::Image                     const  dst,
+				vk::ImageSubresourceRange     const &,
+				std::span<vk::BufferImageCopy const> regions,
+				std::optional<MipGeneration>  const  mipGeneration = std::nullopt
+			);
+			void                       retain( std::unique_ptr<Buffer> ); // keeps e.g. a staging buffer alive until the open batch completes
+			UploadTicket               flush();                           // submits the open batch (if any)
+			void                       collect();                         // recycles completed batches
+			[[nodiscard]] bool         isComplete( UploadTicket const );
+			void                       wait(       UploadTicket const );
+		
+		private:
+			struct Batch;
+			[[nodiscard]] Batch & getRecordingBatch();
+			void                  recordImageCopies( Batch & );
+			void                  recordMipChains( Batch &, vk::raii::CommandBuffer & );
+			void                  waitForBatch( Batch & );
+			void                  recycle( Batch & );
+			
+			vk::raii::Device   const           *mpDevice;
+			vk::raii::Queue    const           *mpTransferQueue;
+			vk::raii::Queue    const           *mpGraphicsQueue;
+			QueueFamilyIndices                  mQueueFamilyIndices;
+			bool                                mNeedsOwnershipTransfer;
+			std::vector<std::unique_ptr<Batch>> mBatches;          // used as a ring
+			u32                                 mRecordingIndex;   // index of the batch that is (or will be) recorded into
+			u64                                 mNextBatchId;
+			u64                                 mLastSubmittedId;
+	}; // end-of-class: UploadService
+} // end-of-namespace: gfx
+
+#endif // end-of-header-guard UPLOADSERVICE_HPP_T8VJ4NCA
+// EOF
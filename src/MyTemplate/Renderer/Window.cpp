@@ -11,17 +11,39 @@
 
 #include <utility>
 #include <stdexcept>
+#include <thread>
 
 // TODO: wrap mpWindow with a unique_ptr instead
 
 namespace gfx {
+	namespace { // private (file-scope)
+		auto constexpr kResizePollInterval { std::chrono::milliseconds( 10 ) }; // while minimized
+		
+		[[nodiscard]] u64
+		pack( Window::Dimensions const dimensions ) noexcept
+		{
+			return static_cast<u64>( static_cast<u32>( dimensions.width ) ) << 32 | static_cast<u32>( dimensions.height );
+		} // end-of-function: pack
+		
+		[[nodiscard]] Window::Dimensions
+		unpack( u64 const packed ) noexcept
+		{
+			return { static_cast<int>( packed >> 32 ), static_cast<int>( packed & 0xFFFF'FFFF ) };
+		} // end-of-function: unpack
+	} // end-of-unnamed-namespace
+	
 	// NOTE: the GlfwInstance reference is just to ensure that GLFW is initialized
 	Window::Window(
 		[[maybe_unused]] GlfwInstance const &,
 		vk::raii::Instance            const &vkInstance,
-		bool                                &setOnResize
+		std::atomic<bool>                   &setOnResize
 	):
-		mpSetOnResize { &setOnResize }
+		mpSetOnResize          { &setOnResize },
+		mFramebufferDimensions { 0            },
+		mWasClosed             { false        },
+		mEvents                {              },
+		mDroppedEventCount     { 0            },
+		mOldestPolledEventTime {              }
 	{
 		spdlog::info( "Constructing a Window instance..." );
 		
@@ -46,23 +68,21 @@ namespace gfx {
 			throw std::runtime_error { "Unable to create GLFW window surface!" };
 		else {
 			mpSurface = std::make_unique<vk::raii::SurfaceKHR>( vkInstance, surfaceTemp );
+			Dimensions dimensions;
+			glfwGetFramebufferSize( mpWindow, &dimensions.width, &dimensions.height );
+			mFramebufferDimensions.store( pack( dimensions ), std::memory_order_relaxed );
 			// setup callback(s):
-			glfwSetWindowUserPointer(  mpWindow, this );
-			glfwSetWindowSizeCallback( mpWindow, onResizeCallback );
+			glfwSetWindowUserPointer(       mpWindow, this                        );
+			glfwSetFramebufferSizeCallback( mpWindow, onFramebufferResizeCallback );
+			glfwSetWindowCloseCallback(     mpWindow, onCloseCallback             );
 		}
 	} // end-of-function: Window::Window
 	
-	Window::Window( Window &&other ) noexcept:
-		mpSurface     ( std::move(     other.mpSurface              ) ),
-		mpWindow      ( std::exchange( other.mpWindow,      nullptr ) ), // TODO: verify
-		mpSetOnResize ( std::exchange( other.mpSetOnResize, nullptr ) )  // TODO: verify
-	{
-		spdlog::info( "Moving a Window instance..." );
-	} // end-of-function: Window::Window
-	
 	Window::~Window() noexcept
 	{
 		spdlog::info( "Destroying a Window instance..." );
+		if ( mDroppedEventCount > 0 ) [[unlikely]]
+			spdlog::warn( "... {} window event(s) were dropped (the event queue was full)", mDroppedEventCount );
 		// NOTE: Vulkan-Hpp should take care of cleaning up the surface for us
 		if ( mpWindow ) [[likely]] {
 			spdlog::info( "... destroying GLFW window" );
@@ -71,18 +91,14 @@ namespace gfx {
 	} // end-of-function: Window::~Window
 	
 	[[nodiscard]] Window::Dimensions
-	Window::getFramebufferDimensions() const
+	Window::getFramebufferDimensions() const noexcept
 	{
-		spdlog::debug( "Accessing framebuffer dimensions..." );
-		Dimensions dimensions;
-		glfwGetFramebufferSize( mpWindow, &dimensions.width, &dimensions.height );
-		return dimensions;
-	} // end-of-function: Window::getDimensions	
+		return unpack( mFramebufferDimensions.load( std::memory_order_acquire ) );
+	} // end-of-function: Window::getFramebufferDimensions
 	
 	[[nodiscard]] Window::Dimensions
 	Window::getWindowDimensions() const
 	{
-		spdlog::debug( "Accessing window dimensions..." );
 		Dimensions dimensions;
 		glfwGetWindowSize( mpWindow, &dimensions.width, &dimensions.height );
 		return dimensions;
@@ -91,45 +107,86 @@ namespace gfx {
 	[[nodiscard]] vk::raii::SurfaceKHR const &
 	Window::getSurface() const
 	{
-		spdlog::debug( "Accessing window surface..." );
 		return *mpSurface;
 	} // end-of-function: Window::getSurface
 	
 	[[nodiscard]] vk::raii::SurfaceKHR &
 	Window::getSurface()
 	{
-		spdlog::debug( "Accessing window surface..." );
 		return *mpSurface;
 	} // end-of-function: Window::getSurface
 	
 	[[nodiscard]] bool
-	Window::wasClosed() const
+	Window::wasClosed() const noexcept
 	{
-		return glfwWindowShouldClose( mpWindow );
+		return mWasClosed.load( std::memory_order_acquire );
 	} // end-of-function: Window::wasClosed
-
+	
 	void
-	Window::update()
+	Window::requestClose() noexcept
 	{
-		glfwSwapBuffers( mpWindow );
-		glfwPollEvents(); // TODO: expose usage somehow
-	} // end-of-function: Window::update
+		mWasClosed.store( true, std::memory_order_release );
+		glfwPostEmptyEvent(); // NOTE: thread-safe; wakes up `pumpEvents`
+	} // end-of-function: Window::requestClose
 	
 	void
-	Window::waitResize()
+	Window::pumpEvents( f64 const timeoutSeconds )
+	{
+		glfwWaitEventsTimeout( timeoutSeconds ); // NOTE: the callbacks are invoked from in here
+	} // end-of-function: Window::pumpEvents
+	
+	[[nodiscard]] std::optional<Window::Event>
+	Window::pollEvent() noexcept
 	{
-		i32 width, height;
-		glfwGetFramebufferSize( mpWindow, &width, &height );
-		while ( width == 0 or height == 0 ) {
-		    glfwGetFramebufferSize( mpWindow, &width, &height );
-		    glfwWaitEvents();
+		auto event { mEvents.tryPop() };
+		if ( event and not mOldestPolledEventTime ) // NOTE: the events are popped in the order they arrived in
+			mOldestPolledEventTime = event->time;
+		return event;
+	} // end-of-function: Window::pollEvent
+	
+	[[nodiscard]] std::optional<std::chrono::steady_clock::time_point>
+	Window::takeOldestPolledEventTime() noexcept
+	{
+		return std::exchange( mOldestPolledEventTime, std::nullopt );
+	} // end-of-function: Window::takeOldestPolledEventTime
+	
+	[[nodiscard]] bool
+	Window::waitResize() const
+	{
+		// NOTE: a minimized window has a zero-sized framebuffer, for which no swapchain can be made
+		while ( not wasClosed() ) {
+			auto const [width, height] { getFramebufferDimensions() };
+			if ( width != 0 and height != 0 ) [[likely]]
+				return true;
+			std::this_thread::sleep_for( kResizePollInterval );
 		}
+		return false;
 	} // end-of-function: Window::waitResize
 	
 	void
-	Window::onResizeCallback( GLFWwindow *pWindow, [[maybe_unused]] int width, [[maybe_unused]] int height )
+	Window::pushEvent( Event const &event ) noexcept
+	{
+		// NOTE: the state in the atomics is always up to date, so a full queue only costs its consumer some detail
+		if ( not mEvents.tryPush( event ) ) [[unlikely]]
+			++mDroppedEventCount;
+	} // end-of-function: Window::pushEvent
+	
+	void
+	Window::onFramebufferResizeCallback( GLFWwindow *pWindow, int width, int height )
+	{
+		auto &window { *static_cast<Window*>( glfwGetWindowUserPointer(pWindow) ) };
+		Dimensions const dimensions { width, height };
+		window.mFramebufferDimensions.store( pack( dimensions ), std::memory_order_release );
+		window.mpSetOnResize->store( true, std::memory_order_release );
+		window.pushEvent( Event { .type = Event::Type::eResized, .dimensions = dimensions, .time = std::chrono::steady_clock::now() } );
+	} // end-of-function: Window::onFramebufferResizeCallback
+	
+	void
+	Window::onCloseCallback( GLFWwindow *pWindow )
 	{
-		*(static_cast<Window*>( glfwGetWindowUserPointer(pWindow) )->mpSetOnResize) = true;
-	} // end-of-function: Window::onResizeCallback
+		auto &window { *static_cast<Window*>( glfwGetWindowUserPointer(pWindow) ) };
+		window.mWasClosed.store( true, std::memory_order_release );
+		window.pushEvent( Event { .type = Event::Type::eClosed, .dimensions = {}, .time = std::chrono::steady_clock::now() } );
+	} // end-of-function: Window::onCloseCallback
 } // end-of-namespace: gfx
 // EOF
@@ -2,7 +2,13 @@
 #ifndef WINDOW_HPP_ZGKG5SWR
 #define WINDOW_HPP_ZGKG5SWR
 
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/SpscQueue.hpp"
+
 #include <memory>
+#include <chrono>
+#include <atomic>
+#include <optional>
 
 // forward declarations:
 class GLFWwindow;
@@ -15,28 +21,54 @@ namespace vk::raii {
 }
 
 namespace gfx {
+	// NOTE: GLFW only allows the window to be created and its events to be pumped on the main thread, while
+	//       rendering runs on a thread of its own. The main thread is the producer of the events (which its
+	//       callbacks push onto a lock-free queue) and the render thread is their consumer; the state the
+	//       renderer needs (framebuffer size, closure) is mirrored in atomics so any thread may read it.
 	class Window final {
 		public:
 			struct Dimensions final { int width, height; }; // TODO: refactor later
-			Window( GlfwInstance const &, vk::raii::Instance const &, bool &setOnResize );
+			
+			struct Event final {
+				enum struct Type { eResized, eClosed };
+				Type                                  type       { Type::eResized };
+				Dimensions                            dimensions { 0, 0 };       // of the framebuffer (in pixels) if resized
+				std::chrono::steady_clock::time_point time       {};             // when the callback received it
+			}; // end-of-struct: Window::Event
+			
+			Window( GlfwInstance const &, vk::raii::Instance const &, std::atomic<bool> &setOnResize );
 			Window(                ) = delete;
 			Window( Window const & ) = delete;
-			Window( Window &&      ) noexcept;
+			Window( Window &&      ) = delete; // NOTE: GLFW holds on to `this` as the window user pointer
 			~Window()                noexcept;
 			// TODO: assignment operators?
-			[[nodiscard]] Dimensions                   getFramebufferDimensions() const;
-			[[nodiscard]] Dimensions                   getWindowDimensions()      const;
+			[[nodiscard]] Dimensions                   getFramebufferDimensions() const noexcept; // any thread
+			[[nodiscard]] Dimensions                   getWindowDimensions()      const;          // main thread only
 			[[nodiscard]] vk::raii::SurfaceKHR const & getSurface()               const;
 			[[nodiscard]] vk::raii::SurfaceKHR       & getSurface()                    ;
-			[[nodiscard]] bool                         wasClosed()                const;
-			void                                       update()                        ;
-			void                                       waitResize()                    ;
+			[[nodiscard]] bool                         wasClosed()                const noexcept; // any thread
+			void                                       requestClose()                   noexcept; // any thread; also wakes the main thread
+			// main thread only; waits (at most the timeout) for events and dispatches them:
+			void                                       pumpEvents( f64 const timeoutSeconds );
+			// consumer thread only; returns the next queued event (if any), i.e. samples the input:
+			[[nodiscard]] std::optional<Event>         pollEvent() noexcept;
+			// consumer thread only; when the oldest event returned by `pollEvent` since the last call arrived (if any):
+			[[nodiscard]] std::optional<std::chrono::steady_clock::time_point> takeOldestPolledEventTime() noexcept;
+			// any thread but the main one; blocks while minimized, returns false if closed in the meantime:
+			[[nodiscard]] bool                         waitResize()               const;
 		private:
-			static void onResizeCallback( GLFWwindow *, [[maybe_unused]] int width, [[maybe_unused]] int height );
+			static void onFramebufferResizeCallback( GLFWwindow *, int width, int height );
+			static void onCloseCallback(             GLFWwindow * );
+			void        pushEvent( Event const & ) noexcept;
 			
-			std::unique_ptr<vk::raii::SurfaceKHR>  mpSurface;
-			GLFWwindow                            *mpWindow;
-			bool                                  *mpSetOnResize;
+			std::unique_ptr<vk::raii::SurfaceKHR>                 mpSurface;
+			GLFWwindow                                           *mpWindow;
+			std::atomic<bool>                                    *mpSetOnResize;
+			std::atomic<u64>                                      mFramebufferDimensions; // packed: width << 32 | height
+			std::atomic<bool>                                     mWasClosed;
+			SpscQueue<Event,64>                                   mEvents;
+			u64                                                   mDroppedEventCount;     // main thread only
+			std::optional<std::chrono::steady_clock::time_point>  mOldestPolledEventTime; // consumer thread only
 	}; // end-of-class: Window
 } // end-of-namespace: gfx
 
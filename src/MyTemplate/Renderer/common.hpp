@@ -5,6 +5,7 @@
 #include "MyTemplate/info.hpp"
 #include "MyTemplate/Common/aliases.hpp"
 #include "MyTemplate/Common/utility.hpp"
+#include "MyTemplate/Renderer/Allocator.hpp"
 
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_raii.hpp>
@@ -16,6 +17,7 @@
 	class GLFWwindow;
 	namespace vk::raii {
 		class CommandPool;
+		class CommandBuffer;
 		class CommandBuffers;
 		class Context;
 		class DebugUtilsMessengerEXT;
@@ -26,6 +28,7 @@
 		class Instance;
 		class PhysicalDevice;
 		class Pipeline;
+		class PipelineCache;
 		class PipelineLayout;
 		class Queue;
 		class RenderPass;
@@ -35,9 +38,12 @@
 		class SwapchainKHR;
 	} // end-of-namespace: vk::raii
 	namespace gfx {
+		class Allocator   ;
 		class GlfwInstance;
 		class Window      ;
 		class Renderer    ;
+		class StagingRing ;
+		class UploadService;
 	} // end-of-namespace: gfx
 
 
@@ -50,6 +56,11 @@
 			eTriple = 3,
 		}; // end-of-enum-struct: FramebufferingPriority
 		
+		enum struct DisplayMode {
+			eWindowed, // GLFW window + swapchain
+			eHeadless, // offscreen images; no GLFW, surface, or swapchain (e.g. for CI and benchmarks)
+		}; // end-of-enum-struct: DisplayMode
+		
 		enum struct PresentationPriority {
 			eMinimalLatency         ,
 			eMinimalStuttering      ,
@@ -69,9 +80,14 @@
 		}; // end-of-struct: QueueFamilyIndices
 		
 		struct Buffer {
-			vk::raii::Buffer        handle;
-			vk::raii::DeviceMemory  memory;
+			Allocation        allocation; // NOTE: declared first so that the handle is destroyed before its memory is released
+			vk::raii::Buffer  handle;
 		}; // end-of-struct: Buffer
+		
+		struct Image {
+			Allocation        allocation; // NOTE: declared first so that the handle is destroyed before its memory is released
+			vk::raii::Image   handle;
+		}; // end-of-struct: Image
 	} // end-of-namespace: gfx
 
 
@@ -0,0 +1,249 @@
+#include <doctest/doctest.h>
+
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Renderer/Suballocator.hpp"
+
+TEST_CASE( "FreeListSuballocator picks the best fitting free range" )
+{
+	gfx::FreeListSuballocator suballocator { 1024 };
+	// carve out two holes of different sizes: [64,320) and [384,512)
+	auto const a { suballocator.allocate(  64, 1 ) };
+	auto const b { suballocator.allocate( 256, 1 ) };
+	auto const c { suballocator.allocate(  64, 1 ) };
+	auto const d { suballocator.allocate( 128, 1 ) };
+	auto const e { suballocator.allocate(  64, 1 ) };
+	REQUIRE( (a and b and c and d and e) );
+	CHECK( *b ==  64u );
+	CHECK( *d == 384u );
+	suballocator.free( *b );
+	suballocator.free( *d );
+	
+	// both holes (and the tail) fit 100 bytes, but the 128 byte hole is the tightest:
+	auto const small { suballocator.allocate( 100, 1 ) };
+	REQUIRE( small );
+	CHECK( *small == 384u );
+	// only the 256 byte hole and the tail fit 200 bytes; the hole is the tighter of the two:
+	auto const large { suballocator.allocate( 200, 1 ) };
+	REQUIRE( large );
+	CHECK( *large == 64u );
+}
+
+
+
+TEST_CASE( "FreeListSuballocator accounts for the alignment padding when picking the best fit" )
+{
+	gfx::FreeListSuballocator suballocator { 1024 };
+	// carve out two holes: [192,320), which is mostly padding once aligned, and [512,612)
+	auto const a { suballocator.allocate( 192, 1 ) };
+	auto const b { suballocator.allocate( 128, 1 ) };
+	auto const c { suballocator.allocate( 192, 1 ) };
+	auto const d { suballocator.allocate( 100, 1 ) };
+	REQUIRE( (a and b and c and d) );
+	suballocator.free( *b );
+	suballocator.free( *d );
+	
+	// the first hole is the larger one, but it's an exact fit once the padding is accounted for:
+	auto const aligned { suballocator.allocate( 64, 256 ) };
+	REQUIRE( aligned );
+	CHECK( *aligned == 256u );
+}
+
+
+
+TEST_CASE( "FreeListSuballocator returns aligned offsets and keeps the padding free" )
+{
+	gfx::FreeListSuballocator suballocator { 4096 };
+	auto const unaligned { suballocator.allocate( 3, 1 ) };
+	REQUIRE( unaligned );
+	CHECK( *unaligned == 0u );
+	
+	for ( u64 const alignment: { 4u, 16u, 256u, 1024u } ) {
+		auto const offset { suballocator.allocate( 5, alignment ) };
+		REQUIRE( offset );
+		CHECK( *offset % alignment == 0u );
+	}
+	CHECK( suballocator.getUsedSize()        == 3u + 4u * 5u );
+	CHECK( suballocator.getAllocationCount() == 5u );
+	
+	// the leading padding is still usable by later allocations:
+	auto const padding { suballocator.allocate( 1, 1 ) };
+	REQUIRE( padding );
+	CHECK( *padding == 3u );
+}
+
+
+
+TEST_CASE( "FreeListSuballocator coalesces neighbouring free ranges" )
+{
+	gfx::FreeListSuballocator suballocator { 300 };
+	auto const a { suballocator.allocate( 100, 1 ) };
+	auto const b { suballocator.allocate( 100, 1 ) };
+	auto const c { suballocator.allocate( 100, 1 ) };
+	REQUIRE( (a and b and c) );
+	CHECK( suballocator.getFreeRangeCount() == 0u );
+	
+	suballocator.free( *a );
+	suballocator.free( *c );
+	CHECK( suballocator.getFreeRangeCount()   == 2u );
+	CHECK( suballocator.getLargestFreeRange() == 100u );
+	
+	suballocator.free( *b ); // merges with both the preceding and the following range
+	CHECK( suballocator.getFreeRangeCount()   == 1u );
+	CHECK( suballocator.getLargestFreeRange() == 300u );
+	CHECK( suballocator.isEmpty() );
+	
+	auto const whole { suballocator.allocate( 300, 1 ) };
+	REQUIRE( whole );
+	CHECK( *whole == 0u );
+}
+
+
+
+TEST_CASE( "FreeListSuballocator returns nothing once exhausted" )
+{
+	gfx::FreeListSuballocator suballocator { 256 };
+	CHECK_FALSE( suballocator.allocate( 257, 1 ) );
+	
+	auto const a { suballocator.allocate( 128, 1 ) };
+	auto const b { suballocator.allocate(  64, 1 ) };
+	auto const c { suballocator.allocate(  64, 1 ) };
+	REQUIRE( (a and b and c) );
+	CHECK_FALSE( suballocator.allocate( 1, 1 ) );
+	
+	// enough free space in total, but not in one contiguous range:
+	suballocator.free( *a );
+	suballocator.free( *c );
+	CHECK( suballocator.getFreeSize()         == 192u );
+	CHECK( suballocator.getLargestFreeRange() == 128u );
+	CHECK_FALSE( suballocator.allocate( 192, 1 ) );
+	CHECK_FALSE( gfx::FreeListSuballocator { 0 }.allocate( 1, 1 ) );
+}
+
+
+
+TEST_CASE( "FreeListSuballocator accounts for the alignment padding when searching" )
+{
+	gfx::FreeListSuballocator suballocator { 256 };
+	REQUIRE( suballocator.allocate( 1, 1 ) );
+	// 255 bytes are free, but only 128 of them once aligned:
+	CHECK_FALSE( suballocator.allocate( 200, 128 ) );
+	auto const aligned { suballocator.allocate( 128, 128 ) };
+	REQUIRE( aligned );
+	CHECK( *aligned == 128u );
+}
+
+
+
+TEST_CASE( "FreeListSuballocator reports its used size and fragmentation" )
+{
+	gfx::FreeListSuballocator suballocator { 400 };
+	CHECK( suballocator.getCapacity()      == 400u );
+	CHECK( suballocator.getUsedSize()      == 0u );
+	CHECK( suballocator.getFreeSize()      == 400u );
+	CHECK( suballocator.getFragmentation() == 0.0f ); // all free space is contiguous
+	
+	auto const a { suballocator.allocate( 100, 1 ) };
+	auto const b { suballocator.allocate( 100, 1 ) };
+	auto const c { suballocator.allocate( 100, 1 ) };
+	auto const d { suballocator.allocate( 100, 1 ) };
+	REQUIRE( (a and b and c and d) );
+	CHECK( suballocator.getUsedSize()      == 400u );
+	CHECK( suballocator.getFreeSize()      == 0u );
+	CHECK( suballocator.getFragmentation() == 0.0f ); // no free space at all
+	
+	suballocator.free( *a );
+	suballocator.free( *c );
+	CHECK( suballocator.getUsedSize()        == 200u );
+	CHECK( suballocator.getAllocationCount() == 2u );
+	CHECK( suballocator.getFragmentation()   == doctest::Approx( 0.5f ) ); // two equally sized free ranges
+	
+	suballocator.free( *d );
+	CHECK( suballocator.getFragmentation() == doctest::Approx( 1.0f / 3.0f ) ); // a 100 byte and a 200 byte free range
+	suballocator.free( *b );
+	CHECK( suballocator.getUsedSize()      == 0u );
+	CHECK( suballocator.getFragmentation() == 0.0f );
+}
+
+
+
+TEST_CASE( "LinearSuballocator bumps aligned offsets until reset" )
+{
+	gfx::LinearSuballocator suballocator { 256 };
+	auto const a { suballocator.allocate( 10,  1 ) };
+	auto const b { suballocator.allocate( 16, 16 ) };
+	REQUIRE( (a and b) );
+	CHECK( *a ==  0u );
+	CHECK( *b == 16u );
+	CHECK( suballocator.getUsedSize() == 32u );
+	CHECK_FALSE( suballocator.allocate( 225, 1 ) );
+	CHECK( suballocator.getUsedSize() == 32u ); // a failed allocation doesn't consume anything
+	
+	suballocator.reset();
+	CHECK( suballocator.getUsedSize() == 0u );
+	CHECK( suballocator.getCapacity() == 256u );
+	auto const whole { suballocator.allocate( 256, 16 ) };
+	REQUIRE( whole );
+	CHECK( *whole == 0u );
+}
+
+
+
+TEST_CASE( "RingSuballocator wraps around once the frames have been released in order" )
+{
+	gfx::RingSuballocator suballocator { 256, 2 };
+	auto const first { suballocator.allocate( 100, 1 ) };
+	REQUIRE( first );
+	CHECK( *first == 0u );
+	suballocator.endFrame( 0 );
+	auto const second { suballocator.allocate( 100, 1 ) };
+	REQUIRE( second );
+	CHECK( *second == 100u );
+	suballocator.endFrame( 1 );
+	
+	// [200,256) is too small and [0,100) is still in flight:
+	CHECK_FALSE( suballocator.allocate( 100, 1 ) );
+	
+	suballocator.releaseFrame( 0 );
+	CHECK( suballocator.getUsedSize() == 100u );
+	auto const wrapped { suballocator.allocate( 100, 1 ) };
+	REQUIRE( wrapped );
+	CHECK( *wrapped == 0u );
+	CHECK( suballocator.getUsedSize()      == 256u ); // including the 56 bytes skipped at the end
+	CHECK( suballocator.getHighWaterMark() == 256u );
+	CHECK_FALSE( suballocator.allocate( 1, 1 ) ); // full
+	suballocator.endFrame( 0 );
+	
+	// releasing the older frame frees exactly its range, i.e. [100,200):
+	suballocator.releaseFrame( 1 );
+	CHECK( suballocator.getUsedSize() == 156u );
+	CHECK_FALSE( suballocator.allocate( 101, 1 ) );
+	auto const reused { suballocator.allocate( 100, 1 ) };
+	REQUIRE( reused );
+	CHECK( *reused == 100u );
+	suballocator.endFrame( 1 );
+	
+	suballocator.releaseFrame( 0 );
+	suballocator.releaseFrame( 1 );
+	CHECK( suballocator.getUsedSize()      == 0u );
+	CHECK( suballocator.getHighWaterMark() == 256u );
+	auto const rewound { suballocator.allocate( 256, 1 ) }; // rewinds to the start since nothing is in flight
+	REQUIRE( rewound );
+	CHECK( *rewound == 0u );
+}
+
+
+
+TEST_CASE( "RingSuballocator returns aligned offsets" )
+{
+	gfx::RingSuballocator suballocator { 1024, 1 };
+	REQUIRE( suballocator.allocate( 3, 1 ) );
+	auto const aligned { suballocator.allocate( 8, 64 ) };
+	REQUIRE( aligned );
+	CHECK( *aligned == 64u );
+	CHECK( suballocator.getUsedSize() == 72u ); // the padding is consumed as well
+	suballocator.endFrame( 0 );
+	suballocator.releaseFrame( 0 );
+	CHECK( suballocator.getUsedSize() == 0u );
+}
+
+// EOF
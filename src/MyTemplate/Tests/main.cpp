@@ -0,0 +1,7 @@
+// Unit tests (run via `ctest`, or directly for doctest's own options; see `--help`).
+// NOTE: The test cases live in one translation unit per tested module next to this one.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+// EOF
@@ -0,0 +1,322 @@
+#include <fmt/core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MyTemplate/Common/utility.hpp"
+#include "MyTemplate/Common/aliases.hpp"
+#include "MyTemplate/Common/Logging.hpp"
+#include "MyTemplate/Common/BlockCompression.hpp"
+#include "MyTemplate/Common/WorkerPool.hpp"
+#include "MyTemplate/Renderer/TextureFile.hpp"
+
+// Compresses an image into a block compressed texture file (see: `gfx::TextureFile`) with a full mip chain
+// (box filtered on the CPU); optionally benchmarks the encoding throughput of the first level.
+
+namespace { // private (file-scope)
+	struct Options final {
+		bc::Format  format             { bc::Format::eBc7                    };
+		bool        isSrgb             { true                                };
+		bool        shouldGenerateMips { true                                };
+		u32         threadCount        { WorkerPool::getDefaultThreadCount() + 1 }; // i.e. one per hardware thread
+		u64         benchmarkRunCount  { 0                                   };
+		std::string inputPath          {                                     };
+		std::string outputPath         {                                     };
+	}; // end-of-struct: Options
+	
+	struct Image final {
+		u32             width;
+		u32             height;
+		std::vector<u8> rgba; // tightly packed
+	}; // end-of-struct: Image
+	
+	
+	
+	// reads a binary PPM (P6) or PAM (P7; with 1 to 4 channels) image with 8 bits per channel:
+	[[nodiscard]] Image
+	readNetpbm( std::string const &path )
+	{
+		std::ifstream file( path, std::ios::binary );
+		if ( not file ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "Failed to open the image `{}`!", path ) };
+		
+		u32 width        { 0 };
+		u32 height       { 0 };
+		u32 channelCount { 0 };
+		u32 maxValue     { 0 };
+		auto const readValue {
+			[&file] {
+				file >> std::ws;
+				while ( file.peek() == '#' ) { // i.e. a comment
+					file.ignore( std::numeric_limits<std::streamsize>::max(), '\n' );
+					file >> std::ws;
+				}
+				u32 value { 0 };
+				file >> value;
+				return value;
+			}
+		};
+		std::string magic;
+		file >> magic;
+		if ( magic == "P6" ) {
+			width        = readValue();
+			height       = readValue();
+			maxValue     = readValue();
+			channelCount = 3;
+		}
+		else if ( magic == "P7" ) {
+			for ( std::string token; file >> token and token != "ENDHDR"; ) {
+				if      ( token == "WIDTH"  ) file >> width;
+				else if ( token == "HEIGHT" ) file >> height;
+				else if ( token == "DEPTH"  ) file >> channelCount;
+				else if ( token == "MAXVAL" ) file >> maxValue;
+				else file.ignore( std::numeric_limits<std::streamsize>::max(), '\n' ); // e.g. TUPLTYPE or a comment
+			}
+		}
+		else [[unlikely]] throw std::runtime_error { fmt::format( "`{}` isn't a binary PPM or PAM image!", path ) };
+		file.get(); // the single whitespace character before the data
+		
+		if ( not file or width == 0 or height == 0 or channelCount == 0 or channelCount > 4 or maxValue != 255 ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` has an unsupported header (only 8 bits per channel are supported)!", path ) };
+		std::vector<u8> data( u64{ width } * height * channelCount );
+		if ( not file.read( reinterpret_cast<char*>( data.data() ), static_cast<std::streamsize>( data.size() ) ) ) [[unlikely]]
+			throw std::runtime_error { fmt::format( "`{}` is truncated!", path ) };
+		
+		// expands gray, gray + alpha, and RGB into RGBA:
+		Image image { .width = width, .height = height, .rgba = std::vector<u8>( u64{ width } * height * 4 ) };
+		bool const isGray   { channelCount < 3       };
+		bool const hasAlpha { channelCount % 2 == 0  };
+		for ( u64 i{0}; i < u64{ width } * height; ++i ) {
+			auto const *pSource { &data[i * channelCount] };
+			auto       *pTarget { &image.rgba[i * 4]      };
+			pTarget[0] = pSource[0];
+			pTarget[1] = pSource[isGray ? 0 : 1];
+			pTarget[2] = pSource[isGray ? 0 : 2];
+			pTarget[3] = hasAlpha ? pSource[channelCount - 1] : 255;
+		}
+		return image;
+	} // end-of-function: readNetpbm
+	
+	
+	
+	[[nodiscard]] f32
+	toLinear( u8 const value ) noexcept
+	{
+		static auto const kTable {
+			[] {
+				std::array<f32,256> table;
+				for ( u32 i{0}; i < table.size(); ++i ) {
+					auto const c { static_cast<f32>( i ) / 255.0f };
+					table[i] = c <= 0.04045f ? c / 12.92f : std::pow( (c + 0.055f) / 1.055f, 2.4f );
+				}
+				return table;
+			}()
+		};
+		return kTable[value];
+	} // end-of-function: toLinear
+	
+	
+	
+	[[nodiscard]] u8
+	toSrgb( f32 const value ) noexcept
+	{
+		auto const c { value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow( value, 1.0f / 2.4f ) - 0.055f };
+		return static_cast<u8>( std::lround( std::clamp( c, 0.0f, 1.0f ) * 255.0f ) );
+	} // end-of-function: toSrgb
+	
+	
+	
+	// halves the extent with a box filter; sRGB colors (but not alpha) are averaged in linear space:
+	[[nodiscard]] Image
+	downsample( Image const &image, bool const isSrgb )
+	{
+		Image result {
+			.width  = std::max( image.width  / 2, 1u ),
+			.height = std::max( image.height / 2, 1u ),
+			.rgba   = {}
+		};
+		result.rgba.resize( u64{ result.width } * result.height * 4 );
+		for ( u32 y{0}; y < result.height; ++y ) {
+			// NOTE: the clamping repeats the last row (or column) of odd extents (or of extents of 1)
+			std::array const sourceRows { std::min( 2 * y, image.height - 1 ), std::min( 2 * y + 1, image.height - 1 ) };
+			for ( u32 x{0}; x < result.width; ++x ) {
+				std::array const sourceColumns { std::min( 2 * x, image.width - 1 ), std::min( 2 * x + 1, image.width - 1 ) };
+				for ( u32 c{0}; c < 4; ++c ) {
+					bool const isLinearized { isSrgb and c < 3 };
+					f32 sum { 0 };
+					for ( auto const sourceY: sourceRows ) {
+						for ( auto const sourceX: sourceColumns ) {
+							auto const value { image.rgba[(u64{ sourceY } * image.width + sourceX) * 4 + c] };
+							sum += isLinearized ? toLinear( value ) : static_cast<f32>( value );
+						}
+					}
+					result.rgba[(u64{ y } * result.width + x) * 4 + c] =
+						isLinearized ? toSrgb( sum / 4.0f ) : static_cast<u8>( std::lround( sum / 4.0f ) );
+				}
+			}
+		}
+		return result;
+	} // end-of-function: downsample
+	
+	
+	
+	// peak signal-to-noise ratio (in dB) of the encoded image over the channels that the format stores:
+	[[nodiscard]] f64
+	getPsnr( Image const &image, std::vector<u8> const &blocks, bc::Format const format )
+	{
+		auto const decoded      { bc::decodeImage( format, blocks, image.width, image.height ) };
+		u32  const channelCount { format == bc::Format::eBc1 ? 3u : format == bc::Format::eBc5 ? 2u : 4u };
+		f64 squaredErrorSum { 0 };
+		for ( u64 i{0}; i < u64{ image.width } * image.height; ++i ) {
+			for ( u32 c{0}; c < channelCount; ++c ) {
+				auto const error { static_cast<f64>( decoded[i*4+c] ) - static_cast<f64>( image.rgba[i*4+c] ) };
+				squaredErrorSum += error * error;
+			}
+		}
+		auto const meanSquaredError { squaredErrorSum / (static_cast<f64>( image.rgba.size() / 4 ) * channelCount) };
+		return meanSquaredError == 0 ? std::numeric_limits<f64>::infinity() : 10.0 * std::log10( 255.0 * 255.0 / meanSquaredError );
+	} // end-of-function: getPsnr
+	
+	
+	
+	// reports the median throughput over the runs, both single threaded and with every thread of the pool:
+	void
+	runBenchmark( Image const &image, Options const &options, WorkerPool &workerPool )
+	{
+		auto const measure {
+			[&]( WorkerPool *pWorkerPool ) {
+				std::vector<f64> runMs;
+				runMs.reserve( options.benchmarkRunCount );
+				for ( u64 run{0}; run < options.benchmarkRunCount; ++run ) {
+					auto const start { std::chrono::steady_clock::now() };
+					auto const blocks { bc::encodeImage( options.format, image.rgba, image.width, image.height, pWorkerPool ) };
+					runMs.push_back( std::chrono::duration<f64,std::milli>( std::chrono::steady_clock::now() - start ).count() );
+				}
+				std::ranges::sort( runMs );
+				return runMs[runMs.size() / 2];
+			}
+		};
+		auto const megatexelCount { static_cast<f64>( image.width ) * image.height / 1'000'000.0 };
+		for ( auto *pWorkerPool: { static_cast<WorkerPool*>( nullptr ), &workerPool } ) {
+			auto const medianMs    { measure( pWorkerPool ) };
+			auto const threadCount { pWorkerPool == nullptr ? 1u : pWorkerPool->getWorkerCount() };
+			fmt::print(
+				"{} {}x{} with {:>2} thread(s): {:9.3f} ms ({:8.2f} Mtexel/s; median of {} run(s))\n",
+				bc::getName( options.format ), image.width, image.height, threadCount,
+				medianMs, megatexelCount / (medianMs / 1'000.0), options.benchmarkRunCount
+			);
+		}
+	} // end-of-function: runBenchmark
+	
+	
+	
+	void
+	printUsage()
+	{
+		fmt::print(
+			"Usage: MyTemplateTextureCompressor [options] <input.ppm|input.pam> <output.ktx2>\n"
+			"  --format <name>    bc1 | bc3 | bc5 | bc7 (default: bc7)\n"
+			"  --linear           store colors as UNORM rather than sRGB (BC5 always is)\n"
+			"  --no-mips          only store the first mip level\n"
+			"  --threads <n>      encoding threads (default: {})\n"
+			"  --benchmark <n>    also report the median encoding throughput of the first level over n runs\n",
+			WorkerPool::getDefaultThreadCount() + 1
+		);
+	} // end-of-function: printUsage
+	
+	
+	
+	[[nodiscard]] std::optional<Options>
+	parseOptions( int argc, char const *argv[] )
+	{
+		Options options {};
+		std::vector<std::string> paths;
+		for ( int i{1}; i < argc; ++i ) {
+			std::string_view const arg { argv[i] };
+			bool const hasValue { i + 1 < argc };
+			if ( arg == "--format" and hasValue ) {
+				auto const format { bc::parseFormat( argv[++i] ) };
+				if ( not format ) [[unlikely]]
+					return std::nullopt;
+				options.format = *format;
+			}
+			else if ( arg == "--linear"                 ) options.isSrgb             = false;
+			else if ( arg == "--no-mips"                ) options.shouldGenerateMips = false;
+			else if ( arg == "--threads"   and hasValue ) options.threadCount        = static_cast<u32>( std::stoul( argv[++i] ) );
+			else if ( arg == "--benchmark" and hasValue ) options.benchmarkRunCount  = std::stoull( argv[++i] );
+			else if ( not arg.starts_with( "--" )       ) paths.emplace_back( arg );
+			else return std::nullopt;
+		}
+		if ( paths.size() != 2 or options.threadCount == 0 ) [[unlikely]]
+			return std::nullopt;
+		options.inputPath  = paths[0];
+		options.outputPath = paths[1];
+		if ( options.format == bc::Format::eBc5 )
+			options.isSrgb = false;
+		return options;
+	} // end-of-function: parseOptions
+} // end-of-unnamed-namespace
+
+int
+main( int argc, char const *argv[] )
+{
+	auto const options { parseOptions( argc, argv ) };
+	if ( not options ) {
+		printUsage();
+		return EXIT_FAILURE;
+	}
+	
+	logging::initialize( spdlog::level::info );
+	std::atexit( spdlog::shutdown );
+	
+	if constexpr ( kIsDebugMode )
+		spdlog::warn( "Running a DEBUG build; encoding (and benchmarking) will be slow!" );
+	
+	try {
+		auto const image { readNetpbm( options->inputPath ) };
+		WorkerPool workerPool { options->threadCount - 1 }; // NOTE: the calling thread participates too
+		if ( options->benchmarkRunCount > 0 )
+			runBenchmark( image, *options, workerPool );
+		
+		gfx::TextureFile file {
+			.format = gfx::getVkFormat( options->format, options->isSrgb ),
+			.extent = vk::Extent2D { .width = image.width, .height = image.height },
+			.levels = {}
+		};
+		auto level { image };
+		while ( true ) {
+			file.levels.push_back( bc::encodeImage( options->format, level.rgba, level.width, level.height, &workerPool ) );
+			if ( not options->shouldGenerateMips or (level.width == 1 and level.height == 1) )
+				break;
+			level = downsample( level, options->isSrgb );
+		}
+		auto const psnr { getPsnr( image, file.levels.front(), options->format ) };
+		file.saveFile( options->outputPath );
+		
+		u64 byteSize { 0 };
+		for ( auto const &levelData: file.levels )
+			byteSize += levelData.size();
+		fmt::print(
+			"Wrote {} mip level(s) of {}x{} `{}` to `{}` ({} byte(s); the first level has a PSNR of {:.2f} dB)\n",
+			file.levels.size(), image.width, image.height, to_string( file.format ), options->outputPath, byteSize, psnr
+		);
+	}
+	catch ( std::exception const &e ) {
+		spdlog::critical( "std::exception: {}", e.what() );
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+} // end-of-function: main
+
+// EOF